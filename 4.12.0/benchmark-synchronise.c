@@ -0,0 +1,247 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file benchmark-synchronise.c
+ * \brief Source file of a microbenchmark comparing the point-to-point and the
+ *   collective synchronisations of the MPI tasks at the end of every step.
+ *
+ * Every synchronisation merges the best simulations of all the tasks on the
+ * master task, shares the stop flag and sends the refined ranges of the
+ * variables to all the tasks. The syntax is:
+ * > $ mpirun -np ntasks ./benchmark-synchronise [nbest] [nvariables]
+ *   [nsynchronisations]
+ *
+ * and the script benchmark-synchronise.sh runs it for an increasing number of
+ * tasks.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <mpi.h>
+#include "best.h"
+
+int rank;                       ///< Number of MPI task.
+int ntasks;                     ///< Number of MPI tasks.
+
+/**
+ * Function to synchronise the tasks with point-to-point messages, as done
+ *   before using collective operations.
+ */
+static void
+synchronise_point (Best * best, ///< Set of best simulations of the task.
+                   Best * merged,
+                   ///< Set of merged best simulations on the master task.
+                   unsigned int nbest,  ///< Number of best simulations.
+                   double *range,       ///< Array of variable ranges.
+                   unsigned int nvariables,     ///< Number of variables.
+                   unsigned int *stop)  ///< Stop flag.
+{
+  MPI_Status mpi_stat;
+  unsigned int simulation[nbest];
+  double error[nbest];
+  Best received[nbest];
+  unsigned int i, nsaveds, s;
+  if (rank == 0)
+    {
+      memcpy (merged, best, nbest * sizeof (Best));
+      for (i = 1; (int) i < ntasks; ++i)
+        {
+          MPI_Recv (&nsaveds, 1, MPI_INT, i, 1, MPI_COMM_WORLD, &mpi_stat);
+          MPI_Recv (simulation, nsaveds, MPI_INT, i, 1, MPI_COMM_WORLD,
+                    &mpi_stat);
+          MPI_Recv (error, nsaveds, MPI_DOUBLE, i, 1, MPI_COMM_WORLD,
+                    &mpi_stat);
+          best_fill (received, simulation, error, nsaveds, nbest);
+          best_merge (received, merged, nbest);
+          MPI_Recv (&s, 1, MPI_UNSIGNED, i, 1, MPI_COMM_WORLD, &mpi_stat);
+          if (s)
+            *stop = 1;
+        }
+      for (i = 1; (int) i < ntasks; ++i)
+        MPI_Send (stop, 1, MPI_UNSIGNED, i, 1, MPI_COMM_WORLD);
+      for (i = 1; (int) i < ntasks; ++i)
+        {
+          MPI_Send (range, nvariables, MPI_DOUBLE, i, 1, MPI_COMM_WORLD);
+          MPI_Send (range + nvariables, nvariables, MPI_DOUBLE, i, 1,
+                    MPI_COMM_WORLD);
+        }
+    }
+  else
+    {
+      for (nsaveds = 0; nsaveds < nbest && best[nsaveds].simulation >= 0;
+           ++nsaveds)
+        {
+          simulation[nsaveds] = (unsigned int) best[nsaveds].simulation;
+          error[nsaveds] = best[nsaveds].error;
+        }
+      MPI_Send (&nsaveds, 1, MPI_INT, 0, 1, MPI_COMM_WORLD);
+      MPI_Send (simulation, nsaveds, MPI_INT, 0, 1, MPI_COMM_WORLD);
+      MPI_Send (error, nsaveds, MPI_DOUBLE, 0, 1, MPI_COMM_WORLD);
+      MPI_Send (stop, 1, MPI_UNSIGNED, 0, 1, MPI_COMM_WORLD);
+      MPI_Recv (&s, 1, MPI_UNSIGNED, 0, 1, MPI_COMM_WORLD, &mpi_stat);
+      if (s)
+        *stop = 1;
+      MPI_Recv (range, nvariables, MPI_DOUBLE, 0, 1, MPI_COMM_WORLD,
+                &mpi_stat);
+      MPI_Recv (range + nvariables, nvariables, MPI_DOUBLE, 0, 1,
+                MPI_COMM_WORLD, &mpi_stat);
+    }
+}
+
+/**
+ * Function to synchronise the tasks with collective operations, as done in
+ *   optimize_synchronise() and optimize_refine().
+ */
+static void
+synchronise_collective (Best * best,    ///< Set of best simulations.
+                        Best * merged,
+                        ///< Set of merged best simulations on the master task.
+                        MPI_Datatype type,
+                        ///< MPI type of a set of best simulations.
+                        MPI_Op op,      ///< MPI reduction of the best sets.
+                        double *range,  ///< Array of variable ranges.
+                        unsigned int nvariables,        ///< Number of variables.
+                        unsigned int *stop)     ///< Stop flag.
+{
+  unsigned int s;
+  MPI_Reduce (best, merged, 1, type, op, 0, MPI_COMM_WORLD);
+  MPI_Allreduce (stop, &s, 1, MPI_UNSIGNED, MPI_MAX, MPI_COMM_WORLD);
+  *stop = s;
+  MPI_Bcast (range, nvariables, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  MPI_Bcast (range + nvariables, nvariables, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+}
+
+/**
+ * Main function.
+ *
+ * \return 0 on success, 1 on error.
+ */
+int
+main (int argn,                 ///< Arguments number.
+      char **argc)              ///< Arguments pointer.
+{
+  MPI_Datatype type;
+  MPI_Op op;
+  Best *best, *merged, *merged_point;
+  double *range;
+  double t, time_point, time_collective;
+  unsigned int i, nbest, nvariables, nsynchronisations, stop, error;
+
+  // Reading the arguments
+  MPI_Init (&argn, &argc);
+  MPI_Comm_size (MPI_COMM_WORLD, &ntasks);
+  MPI_Comm_rank (MPI_COMM_WORLD, &rank);
+  nbest = (argn > 1) ? atoi (argc[1]) : 20;
+  nvariables = (argn > 2) ? atoi (argc[2]) : 8;
+  nsynchronisations = (argn > 3) ? atoi (argc[3]) : 1000;
+  if (!nbest || !nvariables || !nsynchronisations)
+    {
+      if (rank == 0)
+        printf ("The syntax is:\n"
+                "mpirun -np ntasks ./benchmark-synchronise [nbest] "
+                "[nvariables] [nsynchronisations]\n");
+      MPI_Finalize ();
+      return 1;
+    }
+
+  // Building the best simulations of every task, the first task with less
+  // simulations than the number of best simulations
+  best = (Best *) malloc (nbest * sizeof (Best));
+  merged = (Best *) malloc (nbest * sizeof (Best));
+  merged_point = (Best *) malloc (nbest * sizeof (Best));
+  range = (double *) malloc (2 * nvariables * sizeof (double));
+  for (i = 0; i < nbest; ++i)
+    {
+      best[i].simulation = (int) (rank * nbest + i);
+      best[i].error = (double) ((rank * 7919 + i * 104729) % 1000003)
+        + 1000003. * i;
+    }
+  if (rank == 0)
+    for (i = nbest / 2; i < nbest; ++i)
+      {
+        best[i].simulation = -1;
+        best[i].error = INFINITY;
+      }
+  for (i = 0; i < 2 * nvariables; ++i)
+    range[i] = (double) i;
+  type = best_mpi_type (nbest);
+  op = best_mpi_op ();
+  stop = 0;
+
+  // Point-to-point synchronisations
+  MPI_Barrier (MPI_COMM_WORLD);
+  t = MPI_Wtime ();
+  for (i = 0; i < nsynchronisations; ++i)
+    synchronise_point (best, merged_point, nbest, range, nvariables, &stop);
+  MPI_Barrier (MPI_COMM_WORLD);
+  time_point = (MPI_Wtime () - t) / nsynchronisations;
+
+  // Collective synchronisations
+  MPI_Barrier (MPI_COMM_WORLD);
+  t = MPI_Wtime ();
+  for (i = 0; i < nsynchronisations; ++i)
+    synchronise_collective (best, merged, type, op, range, nvariables, &stop);
+  MPI_Barrier (MPI_COMM_WORLD);
+  time_collective = (MPI_Wtime () - t) / nsynchronisations;
+
+  // Checking and printing the results
+  error = 0;
+  if (rank == 0)
+    {
+      for (i = 0; i < nbest; ++i)
+        if (merged[i].simulation != merged_point[i].simulation
+            || merged[i].error != merged_point[i].error)
+          error = 1;
+      if (error)
+        printf ("ERROR: different best simulations\n");
+      printf ("ntasks=%d nbest=%u nvariables=%u\n"
+              "point-to-point: %.6lg s/synchronisation\n"
+              "collective: %.6lg s/synchronisation\nspeedup: %.6lg\n",
+              ntasks, nbest, nvariables, time_point, time_collective,
+              time_point / time_collective);
+    }
+
+  // Freeing memory
+  MPI_Op_free (&op);
+  MPI_Type_free (&type);
+  free (range);
+  free (merged_point);
+  free (merged);
+  free (best);
+  MPI_Finalize ();
+  return error;
+}
@@ -0,0 +1,12 @@
+#!/usr/bin/env bash
+# Measures the synchronisation latency of the MPI tasks against the number of
+# tasks on the local computer.
+# Usage: ./benchmark-synchronise.sh [maximum_ntasks] [nbest] [nvariables]
+#   [nsynchronisations]
+max=${1:-256}
+n=2
+while [[ $n -le $max ]]; do
+	mpirun --oversubscribe -np $n ./benchmark-synchronise ${2:-20} ${3:-8} \
+		${4:-1000} || exit 1
+	n=$((n * 2))
+done
@@ -0,0 +1,195 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+        this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file benchmark-template.c
+ * \brief Source file of a microbenchmark comparing the precompiled templates
+ *   with the regular expressions substitution of the input files.
+ *
+ * The syntax is:
+ * > $ ./benchmark-template [nvariables] [template_kB] [nrenders]
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libxml/parser.h>
+#include <glib.h>
+#include <json-glib/json-glib.h>
+#include "variable.h"
+#include "template.h"
+
+/**
+ * Function to render a template with regular expressions, as done before
+ *   precompiling the templates.
+ *
+ * \return rendered buffer (to free with g_free).
+ */
+static char *
+render_regex (const char *content,      ///< Template contents.
+              size_t length,   ///< Template contents length.
+              unsigned int nvariables, ///< Number of variables.
+              char **label,    ///< Array of variable names.
+              double *value,   ///< Array of variable values.
+              unsigned int *precision) ///< Array of variable precisions.
+{
+  char buffer[256], text[32];
+  GRegex *regex;
+  char *buffer2, *buffer3 = NULL;
+  unsigned int i;
+  for (i = 0; i < nvariables; ++i)
+    {
+      snprintf (buffer, 32, "@variable%u@", i + 1);
+      regex = g_regex_new (buffer, (GRegexCompileFlags) 0, (GRegexMatchFlags) 0,
+                           NULL);
+      if (i == 0)
+        buffer2 = g_regex_replace_literal (regex, content, length, 0,
+                                           label[i], (GRegexMatchFlags) 0,
+                                           NULL);
+      else
+        {
+          length = strlen (buffer3);
+          buffer2 = g_regex_replace_literal (regex, buffer3, length, 0,
+                                             label[i], (GRegexMatchFlags) 0,
+                                             NULL);
+          g_free (buffer3);
+        }
+      g_regex_unref (regex);
+      length = strlen (buffer2);
+      snprintf (buffer, 32, "@value%u@", i + 1);
+      regex = g_regex_new (buffer, (GRegexCompileFlags) 0, (GRegexMatchFlags) 0,
+                           NULL);
+      snprintf (text, 32, format[precision[i]], value[i]);
+      buffer3 = g_regex_replace_literal (regex, buffer2, length, 0, text,
+                                         (GRegexMatchFlags) 0, NULL);
+      g_free (buffer2);
+      g_regex_unref (regex);
+    }
+  return buffer3;
+}
+
+/**
+ * Main function.
+ *
+ * \return 0 on success, >0 on error.
+ */
+int
+main (int argn,                 ///< Arguments number.
+      char **argc)              ///< Arguments pointer.
+{
+  Template template[1];
+  GString *content;
+  GTimer *timer;
+  char **label, *buffer;
+  const char *render;
+  double *value;
+  unsigned int *precision;
+  double t_regex, t_template;
+  size_t length, size;
+  unsigned int i, nvariables, nrenders;
+
+  // Reading the arguments
+  nvariables = (argn > 1) ? atoi (argc[1]) : 30;
+  size = ((argn > 2) ? atoi (argc[2]) : 200) * 1024;
+  nrenders = (argn > 3) ? atoi (argc[3]) : 100;
+  if (!nvariables || !size || !nrenders)
+    {
+      printf ("The syntax is:\n"
+              "./benchmark-template [nvariables] [template_kB] [nrenders]\n");
+      return 1;
+    }
+
+  // Building the variables
+  label = (char **) g_malloc (nvariables * sizeof (char *));
+  value = (double *) g_malloc (nvariables * sizeof (double));
+  precision = (unsigned int *) g_malloc (nvariables * sizeof (unsigned int));
+  for (i = 0; i < nvariables; ++i)
+    {
+      label[i] = g_strdup_printf ("x%u", i + 1);
+      value[i] = 1. / (i + 3.);
+      precision[i] = i % NPRECISIONS;
+    }
+
+  // Building a template with a pair of slots every 64 bytes of literal text
+  content = g_string_sized_new (size + 64);
+  for (i = 0; content->len < size; ++i)
+    g_string_append_printf (content, "%-*s@variable%u@ = @value%u@\n", 64,
+                            "# input line with literal text",
+                            i % nvariables + 1, i % nvariables + 1);
+  printf ("nvariables=%u template=%lu bytes nrenders=%u\n", nvariables,
+          (unsigned long int) content->len, nrenders);
+
+  // Rendering with regular expressions
+  timer = g_timer_new ();
+  for (i = 0; i < nrenders; ++i)
+    {
+      buffer = render_regex (content->str, content->len, nvariables, label,
+                             value, precision);
+      g_free (buffer);
+    }
+  t_regex = g_timer_elapsed (timer, NULL) / nrenders;
+
+  // Rendering with the precompiled template
+  g_timer_start (timer);
+  template_new (template, content->str, content->len, nvariables);
+  for (i = 0; i < nrenders; ++i)
+    render = template_render (template, 0, label, value, precision, &length);
+  t_template = g_timer_elapsed (timer, NULL) / nrenders;
+
+  // Checking the results
+  buffer = render_regex (content->str, content->len, nvariables, label, value,
+                         precision);
+  render = template_render (template, 0, label, value, precision, &length);
+  if (length != strlen (buffer) || memcmp (buffer, render, length))
+    {
+      printf ("ERROR: different renders\n");
+      return 2;
+    }
+  g_free (buffer);
+
+  // Printing the results
+  printf ("regex: %.6lg s/render\ntemplate: %.6lg s/render\nspeedup: %.6lg\n",
+          t_regex, t_template, t_regex / t_template);
+
+  // Freeing memory
+  template_free (template);
+  g_timer_destroy (timer);
+  g_string_free (content, TRUE);
+  for (i = 0; i < nvariables; ++i)
+    g_free (label[i]);
+  g_free (precision);
+  g_free (value);
+  g_free (label);
+  return 0;
+}
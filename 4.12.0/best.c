@@ -0,0 +1,173 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file best.c
+ * \brief Source file to define the sets of best simulations merged among the
+ *   MPI tasks.
+ *
+ * A set of best simulations is an array of nbest Best structs sorted by
+ * increasing objective function value and completed with empty entries. Two
+ * sets are merged keeping the nbest first entries, an associative and
+ * commutative operation (ties are sorted by simulation number) used as a
+ * custom MPI reduction on a contiguous type of nbest MPI_DOUBLE_INT values.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <math.h>
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+#include "best.h"
+
+/**
+ * Function to fill a set of best simulations from the sorted arrays of
+ *   simulation numbers and objective function values.
+ */
+void
+best_fill (Best * best,         ///< Set of best simulations.
+           unsigned int *simulation,    ///< Array of simulation numbers.
+           double *error,       ///< Array of objective function values.
+           unsigned int nsaveds,        ///< Number of saved simulations.
+           unsigned int nbest)  ///< Number of best simulations.
+{
+  unsigned int i;
+  for (i = 0; i < nsaveds; ++i)
+    {
+      best[i].error = error[i];
+      best[i].simulation = (int) simulation[i];
+    }
+  for (; i < nbest; ++i)
+    {
+      best[i].error = INFINITY;
+      best[i].simulation = -1;
+    }
+}
+
+/**
+ * Function to compare two best simulations, the empty entries being the last.
+ *
+ * \return 1 if the first is better, 0 otherwise.
+ */
+static inline int
+best_less (Best * best1,        ///< 1st best simulation.
+           Best * best2)        ///< 2nd best simulation.
+{
+  if (best2->simulation < 0)
+    return best1->simulation >= 0;
+  if (best1->simulation < 0)
+    return 0;
+  if (best1->error != best2->error)
+    return best1->error < best2->error;
+  return best1->simulation < best2->simulation;
+}
+
+/**
+ * Function to merge two sets of best simulations.
+ *
+ * The numbers of merged simulations of every set are counted first and then
+ * the sets are merged in place from the end, without an auxiliary buffer.
+ */
+void
+best_merge (Best * in,          ///< 1st set of best simulations.
+            Best * inout,
+            ///< 2nd set of best simulations, replaced by the merged set.
+            unsigned int nbest) ///< Number of best simulations.
+{
+  unsigned int i, j, k;
+  for (i = j = k = 0; k < nbest; ++k)
+    if (best_less (in + i, inout + j))
+      ++i;
+    else
+      ++j;
+  while (i)
+    {
+      --k;
+      if (j && best_less (in + i - 1, inout + j - 1))
+        inout[k] = inout[--j];
+      else
+        inout[k] = in[--i];
+    }
+}
+
+#if HAVE_MPI
+
+/**
+ * Function to reduce sets of best simulations on a MPI reduction.
+ */
+static void
+best_mpi_merge (void *in,       ///< Input sets.
+                void *inout,    ///< Input and output sets.
+                int *n,         ///< Number of sets.
+                MPI_Datatype * type)    ///< Type of a set.
+{
+  MPI_Aint lower, extent;
+  Best *best1, *best2;
+  unsigned int nbest;
+  int i;
+  MPI_Type_get_extent (*type, &lower, &extent);
+  nbest = (unsigned int) (extent / sizeof (Best));
+  best1 = (Best *) in;
+  best2 = (Best *) inout;
+  for (i = 0; i < *n; ++i, best1 += nbest, best2 += nbest)
+    best_merge (best1, best2, nbest);
+}
+
+/**
+ * Function to create the MPI type of a set of best simulations.
+ *
+ * \return committed MPI type (to free with MPI_Type_free).
+ */
+MPI_Datatype
+best_mpi_type (unsigned int nbest)      ///< Number of best simulations.
+{
+  MPI_Datatype type;
+  MPI_Type_contiguous ((int) nbest, MPI_DOUBLE_INT, &type);
+  MPI_Type_commit (&type);
+  return type;
+}
+
+/**
+ * Function to create the MPI reduction merging sets of best simulations.
+ *
+ * \return MPI operation (to free with MPI_Op_free).
+ */
+MPI_Op
+best_mpi_op ()
+{
+  MPI_Op op;
+  MPI_Op_create (best_mpi_merge, 1, &op);
+  return op;
+}
+
+#endif
@@ -0,0 +1,62 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file best.h
+ * \brief Header file to define the sets of best simulations merged among the
+ *   MPI tasks.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#ifndef BEST__H
+#define BEST__H 1
+
+/**
+ * \struct Best
+ * \brief Struct to define a best simulation, with the layout of the
+ *   MPI_DOUBLE_INT type.
+ */
+typedef struct
+{
+  double error;                 ///< Objective function value.
+  int simulation;               ///< Simulation number, -1 on empty entries.
+} Best;
+
+// Public functions
+void best_fill (Best * best, unsigned int *simulation, double *error,
+                unsigned int nsaveds, unsigned int nbest);
+void best_merge (Best * in, Best * inout, unsigned int nbest);
+#if HAVE_MPI
+MPI_Datatype best_mpi_type (unsigned int nbest);
+MPI_Op best_mpi_op ();
+#endif
+
+#endif
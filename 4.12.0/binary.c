@@ -0,0 +1,255 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+        this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file binary.c
+ * \brief Source file to define the binary variables file format.
+ *
+ * The binary variables file is column-oriented and it can be mapped in memory
+ * (native byte order, all the values aligned to 8 bytes). It starts with a
+ * header:
+ * - 8 bytes: "MPCOVB1\n".
+ * - 4 bytes: number of variables.
+ * - 4 bytes: length of the header in bytes, a multiple of 8.
+ * - for every variable: 4 bytes with the precision digits, 4 bytes with the
+ *   name length and the name (without final null character).
+ * - zeros up to the header length.
+ *
+ * followed by blocks of simulations of the same iteration:
+ * - 4 bytes: iteration number.
+ * - 4 bytes: number of rows.
+ * - for every variable: a column with the variable values of every row.
+ * - a column with the objective function values of every row.
+ *
+ * Every block is written with a single call, so a file being written or
+ * truncated by a crash has only complete blocks, and at most a partial last
+ * block that is ignored by the readers.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <glib.h>
+#include "binary.h"
+
+#define DEBUG_BINARY 0          ///< Macro to debug binary file functions.
+
+/**
+ * Function to write the header of a binary variables file.
+ *
+ * \return 1 on success, 0 on error.
+ */
+int
+binary_write_header (FILE * file,       ///< File.
+                     char **label,      ///< Array of variable names.
+                     unsigned int *precision,
+                     ///< Array of variable precision digits.
+                     unsigned int nvariables)   ///< Number of variables.
+{
+  GByteArray *header;
+  uint32_t n;
+  unsigned int i;
+  int ok;
+  const guint8 zero[8] = { 0 };
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_write_header: start\n");
+#endif
+  header = g_byte_array_new ();
+  g_byte_array_append (header, (const guint8 *) BINARY_HEADER,
+                       BINARY_HEADER_LENGTH);
+  n = nvariables;
+  g_byte_array_append (header, (const guint8 *) &n, sizeof (uint32_t));
+  g_byte_array_append (header, zero, sizeof (uint32_t));
+  for (i = 0; i < nvariables; ++i)
+    {
+      n = precision[i];
+      g_byte_array_append (header, (const guint8 *) &n, sizeof (uint32_t));
+      n = strlen (label[i]);
+      g_byte_array_append (header, (const guint8 *) &n, sizeof (uint32_t));
+      g_byte_array_append (header, (const guint8 *) label[i], n);
+    }
+  g_byte_array_append (header, zero, (8 - header->len % 8) % 8);
+  n = header->len;
+  memcpy (header->data + BINARY_HEADER_LENGTH + sizeof (uint32_t), &n,
+          sizeof (uint32_t));
+  ok = (fwrite (header->data, 1, header->len, file) == header->len);
+  g_byte_array_free (header, TRUE);
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_write_header: end\n");
+#endif
+  return ok;
+}
+
+/**
+ * Function to write a block of rows in a binary variables file. The first
+ * element of the block is reserved for the block header and it is followed by
+ * the columns, every one with nrows values.
+ *
+ * \return 1 on success, 0 on error.
+ */
+int
+binary_write_block (FILE * file,        ///< File.
+                    double *block,      ///< Block data.
+                    unsigned int iteration,     ///< Iteration number.
+                    unsigned int nrows, ///< Number of rows.
+                    unsigned int ncolumns)      ///< Number of columns.
+{
+  size_t size;
+  uint32_t n[2];
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_write_block: start\n");
+#endif
+  n[0] = iteration;
+  n[1] = nrows;
+  memcpy (block, n, sizeof (double));
+  size = (1 + (size_t) nrows * ncolumns) * sizeof (double);
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_write_block: end\n");
+#endif
+  return (fwrite (block, 1, size, file) == size);
+}
+
+/**
+ * Function to read the header of a binary variables file.
+ *
+ * \return 1 on success, 0 on error.
+ */
+int
+binary_read_header (FILE * file,        ///< File.
+                    char ***label,
+                    ///< Pointer to the array of variable names.
+                    unsigned int **precision,
+                    ///< Pointer to the array of variable precision digits.
+                    unsigned int *nvariables)
+                    ///< Pointer to the number of variables.
+{
+  char buffer[BINARY_HEADER_LENGTH + 2 * sizeof (uint32_t)];
+  char *header;
+  uint32_t n[2];
+  size_t i, length;
+  unsigned int j;
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_read_header: start\n");
+#endif
+  if (fread (buffer, 1, sizeof (buffer), file) != sizeof (buffer)
+      || memcmp (buffer, BINARY_HEADER, BINARY_HEADER_LENGTH))
+    return 0;
+  memcpy (n, buffer + BINARY_HEADER_LENGTH, 2 * sizeof (uint32_t));
+  if (n[1] < sizeof (buffer) || n[1] % 8
+      || n[0] > (n[1] - sizeof (buffer)) / (2 * sizeof (uint32_t)))
+    return 0;
+  length = n[1] - sizeof (buffer);
+  header = (char *) g_malloc (length);
+  if (fread (header, 1, length, file) != length)
+    {
+      g_free (header);
+      return 0;
+    }
+  *nvariables = n[0];
+  *label = (char **) g_malloc0 (n[0] * sizeof (char *));
+  *precision = (unsigned int *) g_malloc (n[0] * sizeof (unsigned int));
+  for (i = j = 0; j < *nvariables; ++j)
+    {
+      if (length - i < 2 * sizeof (uint32_t))
+        goto exit_on_error;
+      memcpy (n, header + i, 2 * sizeof (uint32_t));
+      i += 2 * sizeof (uint32_t);
+      if (length - i < n[1])
+        goto exit_on_error;
+      (*precision)[j] = n[0];
+      (*label)[j] = g_strndup (header + i, n[1]);
+      i += n[1];
+    }
+  g_free (header);
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_read_header: end\n");
+#endif
+  return 1;
+
+exit_on_error:
+  g_free (header);
+  binary_free_header (*label, *precision, *nvariables);
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_read_header: end\n");
+#endif
+  return 0;
+}
+
+/**
+ * Function to read a block of rows of a binary variables file.
+ *
+ * \return 1 on success, 0 on the end of the file or on a partial block.
+ */
+int
+binary_read_block (FILE * file, ///< File.
+                   double **block,
+                   ///< Pointer to the block data (reallocated to fit).
+                   unsigned int *iteration,     ///< Pointer to the iteration.
+                   unsigned int *nrows, ///< Pointer to the number of rows.
+                   unsigned int ncolumns)       ///< Number of columns.
+{
+  size_t size;
+  uint32_t n[2];
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_read_block: start\n");
+#endif
+  if (fread (n, 1, sizeof (double), file) != sizeof (double))
+    return 0;
+  *iteration = n[0];
+  *nrows = n[1];
+  size = (1 + (size_t) n[1] * ncolumns) * sizeof (double);
+  *block = (double *) g_realloc (*block, size);
+  memcpy (*block, n, sizeof (double));
+#if DEBUG_BINARY
+  fprintf (stderr, "binary_read_block: end\n");
+#endif
+  return (fread (*block + 1, 1, size - sizeof (double), file)
+          == size - sizeof (double));
+}
+
+/**
+ * Function to free the header data of a binary variables file.
+ */
+void
+binary_free_header (char **label,       ///< Array of variable names.
+                    unsigned int *precision,
+                    ///< Array of variable precision digits.
+                    unsigned int nvariables)    ///< Number of variables.
+{
+  unsigned int i;
+  for (i = 0; i < nvariables; ++i)
+    g_free (label[i]);
+  g_free (label);
+  g_free (precision);
+}
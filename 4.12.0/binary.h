@@ -0,0 +1,56 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file binary.h
+ * \brief Header file to define the binary variables file format.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#ifndef BINARY__H
+#define BINARY__H 1
+
+#define BINARY_HEADER "MPCOVB1\n"       ///< Header of the binary files.
+#define BINARY_HEADER_LENGTH 8  ///< Length of the binary files header.
+
+// Public functions
+int binary_write_header (FILE * file, char **label, unsigned int *precision,
+                         unsigned int nvariables);
+int binary_write_block (FILE * file, double *block, unsigned int iteration,
+                        unsigned int nrows, unsigned int ncolumns);
+int binary_read_header (FILE * file, char ***label, unsigned int **precision,
+                        unsigned int *nvariables);
+int binary_read_block (FILE * file, double **block, unsigned int *iteration,
+                       unsigned int *nrows, unsigned int ncolumns);
+void binary_free_header (char **label, unsigned int *precision,
+                         unsigned int nvariables);
+
+#endif
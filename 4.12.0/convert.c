@@ -0,0 +1,289 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+        this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file convert.c
+ * \brief Source file of a streaming converter between the text and the binary
+ *   variables file formats.
+ *
+ * The syntax is:
+ * > $ ./mpcotool-convert [-l label1,label2,...] [-i rows] input_file
+ * > output_file
+ *
+ * A binary input file is converted to the text format and a text input file
+ * to the binary format. On text input files the variable names are taken from
+ * the -l option (default names are "variable1", "variable2", ...), the
+ * variable precisions from the digits of the first row and the iterations are
+ * considered to have the number of rows of the -i option (default is a single
+ * iteration).
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include "binary.h"
+
+#define CONVERT_BLOCK_ROWS 4096 ///< Maximum number of rows of the blocks.
+
+/**
+ * Function to convert a binary variables file to the text format.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+convert_binary_to_text (FILE * input,   ///< Binary input file.
+                        FILE * output)  ///< Text output file.
+{
+  char **label;
+  double *block = NULL, *column;
+  unsigned int *precision;
+  unsigned int i, j, iteration, nrows, nvariables;
+  if (!binary_read_header (input, &label, &precision, &nvariables))
+    {
+      printf ("ERROR: bad binary header\n");
+      return 0;
+    }
+  while (binary_read_block (input, &block, &iteration, &nrows,
+                            nvariables + 1))
+    {
+      column = block + 1;
+      for (i = 0; i < nrows; ++i)
+        {
+          // The same format of the text variables file
+          for (j = 0; j < nvariables; ++j)
+            fprintf (output, "%.*lf ", precision[j], column[j * nrows + i]);
+          fprintf (output, "%.14le\n", column[nvariables * nrows + i]);
+        }
+    }
+  g_free (block);
+  binary_free_header (label, precision, nvariables);
+  return 1;
+}
+
+/**
+ * Function to write a block of a binary variables file, packing the columns.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+convert_write_block (FILE * output,     ///< Binary output file.
+                     double *block,     ///< Block data.
+                     unsigned int iteration,    ///< Iteration number.
+                     unsigned int nrows,        ///< Number of rows.
+                     unsigned int ncolumns)     ///< Number of columns.
+{
+  unsigned int i;
+  for (i = 1; i < ncolumns; ++i)
+    memmove (block + 1 + i * nrows, block + 1 + i * CONVERT_BLOCK_ROWS,
+             nrows * sizeof (double));
+  return binary_write_block (output, block, iteration, nrows, ncolumns);
+}
+
+/**
+ * Function to convert a text variables file to the binary format.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+convert_text_to_binary (FILE * input,   ///< Text input file.
+                        FILE * output,  ///< Binary output file.
+                        const char *labels,
+                        ///< Comma separated variable names or NULL.
+                        unsigned int niterations)
+                        ///< Number of rows of every iteration or 0.
+{
+  GString *line;
+  char **label = NULL;
+  char *end, *point;
+  const char *c;
+  double *block, *row;
+  unsigned int *precision;
+  unsigned int i, j, iteration, nrows, ncolumns, nvariables;
+  int ch, ok = 0;
+
+  // Reading the first row to get the columns number and the precisions
+  line = g_string_new (NULL);
+  while ((ch = fgetc (input)) != EOF && ch != '\n')
+    g_string_append_c (line, (char) ch);
+  row = (double *) g_malloc ((line->len / 2 + 1) * sizeof (double));
+  precision = (unsigned int *) g_malloc ((line->len / 2 + 1)
+                                         * sizeof (unsigned int));
+  for (ncolumns = 0, c = line->str;; ++ncolumns)
+    {
+      row[ncolumns] = strtod (c, &end);
+      if (end == c)
+        break;
+      point = memchr (c, '.', end - c);
+      precision[ncolumns] = point ? (unsigned int) (end - point - 1) : 0;
+      if (precision[ncolumns] >= NPRECISIONS)
+        precision[ncolumns] = NPRECISIONS - 1;
+      c = end;
+    }
+  if (ncolumns < 2)
+    {
+      printf ("ERROR: bad text variables file\n");
+      goto convert_end;
+    }
+  nvariables = ncolumns - 1;
+
+  // Getting the variable names
+  if (labels)
+    {
+      label = g_strsplit (labels, ",", 0);
+      if (g_strv_length (label) != nvariables)
+        {
+          printf ("ERROR: %u variable names needed\n", nvariables);
+          goto convert_end;
+        }
+    }
+  else
+    {
+      label = (char **) g_malloc0 ((nvariables + 1) * sizeof (char *));
+      for (i = 0; i < nvariables; ++i)
+        label[i] = g_strdup_printf ("variable%u", i + 1);
+    }
+  if (!binary_write_header (output, label, precision, nvariables))
+    goto convert_end;
+
+  // Converting the rows in blocks of the same iteration
+  block = (double *) g_malloc ((1 + ncolumns * CONVERT_BLOCK_ROWS)
+                               * sizeof (double));
+  for (i = iteration = nrows = 0;;)
+    {
+      for (j = 0; j < ncolumns; ++j)
+        block[1 + j * CONVERT_BLOCK_ROWS + nrows] = row[j];
+      ++nrows;
+      ++i;
+      if (nrows == CONVERT_BLOCK_ROWS || (niterations && i == niterations))
+        {
+          if (!convert_write_block (output, block, iteration, nrows,
+                                    ncolumns))
+            break;
+          nrows = 0;
+          if (niterations && i == niterations)
+            {
+              ++iteration;
+              i = 0;
+            }
+        }
+      for (j = 0; j < ncolumns; ++j)
+        if (fscanf (input, "%lf", row + j) != 1)
+          break;
+      if (j < ncolumns)
+        {
+          ok = (j == 0 && (!nrows || convert_write_block (output, block,
+                                                          iteration, nrows,
+                                                          ncolumns)));
+          if (!ok)
+            printf ("ERROR: bad text variables file\n");
+          break;
+        }
+    }
+  g_free (block);
+
+convert_end:
+  g_strfreev (label);
+  g_free (precision);
+  g_free (row);
+  g_string_free (line, TRUE);
+  return ok;
+}
+
+/**
+ * Main function.
+ *
+ * \return 0 on success, >0 on error.
+ */
+int
+main (int argn,                 ///< Arguments number.
+      char **argc)              ///< Arguments pointer.
+{
+  char header[BINARY_HEADER_LENGTH];
+  FILE *input, *output;
+  const char *labels = NULL;
+  unsigned int niterations = 0;
+  int i, ok;
+
+  // Reading the arguments
+  for (i = 1; i + 2 < argn; i += 2)
+    {
+      if (!strcmp (argc[i], "-l"))
+        labels = argc[i + 1];
+      else if (!strcmp (argc[i], "-i"))
+        niterations = atoi (argc[i + 1]);
+      else
+        break;
+    }
+  if (i + 2 != argn)
+    {
+      printf ("The syntax is:\n./mpcotool-convert [-l label1,label2,...] "
+              "[-i rows] input_file output_file\n");
+      return 1;
+    }
+
+  // Opening the files
+  input = fopen (argc[i], "rb");
+  if (!input)
+    {
+      printf ("ERROR: unable to open the input file\n");
+      return 2;
+    }
+  output = fopen (argc[i + 1], "wb");
+  if (!output)
+    {
+      printf ("ERROR: unable to open the output file\n");
+      fclose (input);
+      return 2;
+    }
+
+  // Converting in the direction given by the input file header
+  if (fread (header, 1, BINARY_HEADER_LENGTH, input) == BINARY_HEADER_LENGTH
+      && !memcmp (header, BINARY_HEADER, BINARY_HEADER_LENGTH))
+    {
+      rewind (input);
+      ok = convert_binary_to_text (input, output);
+    }
+  else
+    {
+      rewind (input);
+      ok = convert_text_to_binary (input, output, labels, niterations);
+    }
+
+  // Closing the files
+  fclose (input);
+  if (fclose (output))
+    ok = 0;
+  return !ok;
+}
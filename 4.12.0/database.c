@@ -0,0 +1,318 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+        this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file database.c
+ * \brief Source file to define the persistent evaluation database.
+ *
+ * The database is an append-only binary file: an 8 bytes header followed by
+ * fixed size records with a SHA-256 simulation digest and the objective
+ * function value (native byte order). It is read by mapping it in memory and
+ * several processes can extend it concurrently, appending whole records with a
+ * file lock.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <libintl.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+#include "jb/src/win.h"
+#include "tools.h"
+#include "database.h"
+
+#define DEBUG_DATABASE 0        ///< Macro to debug database functions.
+
+#define DATABASE_HEADER "MPCODB1\n"     ///< Header of the database files.
+#define DATABASE_HEADER_LENGTH 8        ///< Length of the database header.
+#define DATABASE_RECORD_LENGTH (DATABASE_KEY_LENGTH + sizeof (double))
+///< Length of the database records.
+
+/**
+ * Function to get the hash of a database key.
+ *
+ * \return hash value.
+ */
+static guint
+database_hash (gconstpointer key)       ///< Simulation digest.
+{
+  guint hash;
+  memcpy (&hash, key, sizeof (guint));
+  return hash;
+}
+
+/**
+ * Function to compare two database keys.
+ *
+ * \return TRUE on equal keys, FALSE otherwise.
+ */
+static gboolean
+database_equal (gconstpointer key1,     ///< 1st simulation digest.
+                gconstpointer key2)     ///< 2nd simulation digest.
+{
+  return !memcmp (key1, key2, DATABASE_KEY_LENGTH);
+}
+
+/**
+ * Function to lock or unlock the database file to append records.
+ */
+static inline void
+database_lock (Database * database,     ///< Database struct.
+               int type)        ///< 1 to lock, 0 to unlock.
+{
+#ifdef G_OS_WIN32
+  (void) database;
+  (void) type;
+#else
+  struct flock lock;
+  lock.l_type = type ? F_WRLCK : F_UNLCK;
+  lock.l_whence = SEEK_SET;
+  lock.l_start = lock.l_len = 0;
+  while (fcntl (database->file, F_SETLKW, &lock) == -1)
+    if (errno != EINTR)
+      break;
+#endif
+}
+
+/**
+ * Function to read the records appended to the database file since the last
+ *   read.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+database_update (Database * database)   ///< Database struct.
+{
+  struct stat buffer;
+  GMappedFile *mapped;
+  const char *content;
+  size_t size;
+
+#if DEBUG_DATABASE
+  fprintf (stderr, "database_update: start\n");
+#endif
+
+  // Checking new records
+  if (fstat (database->file, &buffer))
+    return 0;
+  size = buffer.st_size;
+  if (size < DATABASE_HEADER_LENGTH)
+    return 0;
+  size -= (size - DATABASE_HEADER_LENGTH) % DATABASE_RECORD_LENGTH;
+  if (size <= database->size)
+    return 1;
+
+  // Mapping the file and reading the new records
+  mapped = g_mapped_file_new (database->name, FALSE, NULL);
+  if (!mapped)
+    return 0;
+  content = g_mapped_file_get_contents (mapped);
+  if (g_mapped_file_get_length (mapped) < size
+      || memcmp (content, DATABASE_HEADER, DATABASE_HEADER_LENGTH))
+    {
+      g_mapped_file_unref (mapped);
+      return 0;
+    }
+  if (database->size < DATABASE_HEADER_LENGTH)
+    database->size = DATABASE_HEADER_LENGTH;
+  for (; database->size < size; database->size += DATABASE_RECORD_LENGTH)
+    g_hash_table_insert (database->table,
+                         g_memdup2 (content + database->size,
+                                    DATABASE_KEY_LENGTH),
+                         g_memdup2 (content + database->size
+                                    + DATABASE_KEY_LENGTH, sizeof (double)));
+  g_mapped_file_unref (mapped);
+
+#if DEBUG_DATABASE
+  fprintf (stderr, "database_update: records=%u\n",
+           g_hash_table_size (database->table));
+  fprintf (stderr, "database_update: end\n");
+#endif
+  return 1;
+}
+
+/**
+ * Function to open a database, creating the file if it does not exist.
+ *
+ * \return 1 on success, 0 on error.
+ */
+int
+database_open (Database * database,     ///< Database struct.
+               const char *name)        ///< File name.
+{
+  struct stat buffer;
+
+#if DEBUG_DATABASE
+  fprintf (stderr, "database_open: start\n");
+#endif
+
+  // Opening the file
+  database->file = g_open (name, O_RDWR | O_APPEND | O_CREAT, 0644);
+  if (database->file < 0)
+    {
+      error_message = g_strconcat (_("Unable to open the database"), ":\n",
+                                   name, NULL);
+      return 0;
+    }
+  g_mutex_init (database->mutex);
+  database->table = g_hash_table_new_full (database_hash, database_equal,
+                                           g_free, g_free);
+  database->name = g_strdup (name);
+  database->size = 0;
+  database->hits = database->misses = 0;
+
+  // Writing the header of a new file
+  database_lock (database, 1);
+  if (!fstat (database->file, &buffer) && !buffer.st_size
+      && write (database->file, DATABASE_HEADER, DATABASE_HEADER_LENGTH)
+      != DATABASE_HEADER_LENGTH)
+    buffer.st_size = -1;
+  database_lock (database, 0);
+
+  // Reading the records
+  if (buffer.st_size < 0 || !database_update (database))
+    {
+      database_close (database);
+      error_message = g_strconcat (_("Bad database"), ":\n", name, NULL);
+      return 0;
+    }
+
+#if DEBUG_DATABASE
+  fprintf (stderr, "database_open: end\n");
+#endif
+  return 1;
+}
+
+/**
+ * Function to close a database.
+ */
+void
+database_close (Database * database)    ///< Database struct.
+{
+  close (database->file);
+  g_hash_table_destroy (database->table);
+  g_mutex_clear (database->mutex);
+  g_free (database->name);
+  database->name = NULL;
+}
+
+/**
+ * Function to look for a simulation in the database, reading first the
+ *   records appended by other processes if it is not found.
+ *
+ * The file is only mapped again if it has grown past the already read records.
+ *
+ * \return 1 if found, 0 otherwise.
+ */
+int
+database_lookup (Database * database,   ///< Database struct.
+                 const guint8 * key,    ///< Simulation digest.
+                 double *value) ///< Pointer to the objective function value.
+{
+  double *v;
+  size_t size;
+  g_mutex_lock (database->mutex);
+  v = (double *) g_hash_table_lookup (database->table, key);
+  if (!v)
+    {
+      size = database->size;
+      if (database_update (database) && database->size > size)
+        v = (double *) g_hash_table_lookup (database->table, key);
+    }
+  if (v)
+    {
+      *value = *v;
+      ++database->hits;
+    }
+  else
+    ++database->misses;
+  g_mutex_unlock (database->mutex);
+  return v != NULL;
+}
+
+/**
+ * Function to append a simulation to the database.
+ *
+ * If no other process has appended records since the last read, the read size
+ * is advanced over the own record, so that it is not mapped again on lookups.
+ */
+void
+database_append (Database * database,   ///< Database struct.
+                 const guint8 * key,    ///< Simulation digest.
+                 double value)  ///< Objective function value.
+{
+  char record[DATABASE_RECORD_LENGTH];
+  struct stat buffer;
+  size_t size;
+  if (!isfinite (value))
+    return;
+  memcpy (record, key, DATABASE_KEY_LENGTH);
+  memcpy (record + DATABASE_KEY_LENGTH, &value, sizeof (double));
+  g_mutex_lock (database->mutex);
+  database_lock (database, 1);
+
+  // Discarding an incomplete record of a crashed process
+  if (!fstat (database->file, &buffer))
+    {
+      size = buffer.st_size;
+      if (size > DATABASE_HEADER_LENGTH
+          && (size - DATABASE_HEADER_LENGTH) % DATABASE_RECORD_LENGTH)
+        {
+          size -= (size - DATABASE_HEADER_LENGTH) % DATABASE_RECORD_LENGTH;
+          if (ftruncate (database->file, size))
+            goto database_append_end;
+        }
+    }
+  else
+    size = 0;
+
+  // Appending the record
+  if (write (database->file, record, DATABASE_RECORD_LENGTH)
+      != (ssize_t) DATABASE_RECORD_LENGTH)
+    fprintf (stderr, "%s: %s\n", _("Unable to write the database"),
+             database->name);
+  else if (size == database->size)
+    database->size += DATABASE_RECORD_LENGTH;
+  g_hash_table_insert (database->table, g_memdup2 (key, DATABASE_KEY_LENGTH),
+                       g_memdup2 (&value, sizeof (double)));
+
+database_append_end:
+  database_lock (database, 0);
+  g_mutex_unlock (database->mutex);
+}
@@ -0,0 +1,69 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file database.h
+ * \brief Header file to define the persistent evaluation database.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#ifndef DATABASE__H
+#define DATABASE__H 1
+
+/**
+ * \def DATABASE_KEY_LENGTH
+ * \brief Length in bytes of the database keys (SHA-256 digests).
+ */
+#define DATABASE_KEY_LENGTH 32
+
+/**
+ * \struct Database
+ * \brief Struct to define a persistent evaluation database.
+ */
+typedef struct
+{
+  GMutex mutex[1];              ///< Mutex to access the database.
+  GHashTable *table;
+  ///< Hash table of objective function values by simulation digest.
+  char *name;                   ///< File name.
+  size_t size;                  ///< Size of the already read file.
+  int file;                     ///< File descriptor to append records.
+  int hits;                     ///< Number of evaluations found.
+  int misses;                   ///< Number of evaluations not found.
+} Database;
+
+// Public functions
+int database_open (Database * database, const char *name);
+void database_close (Database * database);
+int database_lookup (Database * database, const guint8 * key, double *value);
+void database_append (Database * database, const guint8 * key, double value);
+
+#endif
@@ -39,6 +39,7 @@ OF SUCH DAMAGE.
 #include "config.h"
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 #include <libxml/parser.h>
 #include <libintl.h>
 #include <glib.h>
@@ -70,8 +71,9 @@ input_new ()
 #endif
   input->nvariables = input->nexperiments = input->nsteps = input->nfinal_steps
     = 0;
-  input->simulator = input->evaluator = input->cleaner = input->directory
-    = input->name = NULL;
+  input->nclimbers = 1;
+  input->simulator = input->plugin = input->evaluator = input->cleaner
+    = input->database = input->directory = input->name = NULL;
   input->experiment = NULL;
   input->variable = NULL;
 #if DEBUG_INPUT
@@ -100,16 +102,20 @@ input_free ()
   if (input->type == INPUT_TYPE_XML)
     {
       xmlFree (input->cleaner);
+      xmlFree (input->database);
       xmlFree (input->evaluator);
       xmlFree (input->simulator);
+      xmlFree (input->plugin);
       xmlFree (input->result);
       xmlFree (input->variables);
     }
   else
     {
       g_free (input->cleaner);
+      g_free (input->database);
       g_free (input->evaluator);
       g_free (input->simulator);
+      g_free (input->plugin);
       g_free (input->result);
       g_free (input->variables);
     }
@@ -186,10 +192,13 @@ input_open_xml (xmlDoc * doc)   ///< xmlDoc struct.
   fprintf (stderr, "input_open_xml: variables file=%s\n", input->variables);
 #endif
 
+  // Opening simulator plugin name
+  input->plugin = (char *) xmlGetProp (node, (const xmlChar *) LABEL_PLUGIN);
+
   // Opening simulator program name
   input->simulator =
     (char *) xmlGetProp (node, (const xmlChar *) LABEL_SIMULATOR);
-  if (!input->simulator)
+  if (!input->simulator && !input->plugin)
     {
       input_error (_("Bad simulator program"));
       goto exit_on_error;
@@ -202,6 +211,107 @@ input_open_xml (xmlDoc * doc)   ///< xmlDoc struct.
   // Opening cleaner program name
   input->cleaner = (char *) xmlGetProp (node, (const xmlChar *) LABEL_CLEANER);
 
+  // Opening evaluation database name
+  input->database
+    = (char *) xmlGetProp (node, (const xmlChar *) LABEL_DATABASE);
+
+  // Obtaining the simulator server mode
+  input->server
+    = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_SERVER,
+                                         &error_code, 0);
+  if (!error_code || input->server > 1 || (input->server && !input->simulator))
+    {
+      input_error (_("Bad simulator server mode"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the TCP port and the number of the worker daemons
+  input->port
+    = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_PORT,
+                                         &error_code, 0);
+  if (!error_code || input->port > 65535)
+    {
+      input_error (_("Bad port"));
+      goto exit_on_error;
+    }
+
+  // Checking that only one of the plugin, server and worker daemons modes is
+  // set
+  if ((input->plugin != NULL) + (input->server != 0) + (input->port != 0) > 1)
+    {
+      input_error (_("Incompatible plugin, server and port modes"));
+      goto exit_on_error;
+    }
+  input->workers
+    = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_WORKERS,
+                                         &error_code, 1);
+  if (!error_code || !input->workers)
+    {
+      input_error (_("Bad workers number"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the maximum time waiting for a simulation reply
+  input->timeout
+    = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_TIMEOUT,
+                                         &error_code, DEFAULT_SERVER_TIMEOUT);
+  if (!error_code)
+    {
+      input_error (_("Bad timeout"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the evaluation cache mode
+  input->cache
+    = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_CACHE,
+                                         &error_code, 0);
+  if (!error_code || input->cache > 1)
+    {
+      input_error (_("Bad evaluation cache mode"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the variables file format
+  input->binary
+    = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_BINARY,
+                                         &error_code, 0);
+  if (!error_code || input->binary > 1)
+    {
+      input_error (_("Bad variables file format"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the pruning mode
+  input->prune
+    = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_PRUNE,
+                                         &error_code, 0);
+  if (!error_code || input->prune > 1)
+    {
+      input_error (_("Bad pruning mode"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the pipelined iterations fraction
+  input->pipeline
+    = jb_xml_node_get_float_with_default (node, (const xmlChar *)
+                                          LABEL_PIPELINE, &error_code,
+                                          DEFAULT_PIPELINE);
+  if (!error_code || input->pipeline <= 0. || input->pipeline > 1.)
+    {
+      input_error (_("Bad pipeline fraction"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the chunk size of the dynamic MPI scheduling
+  input->chunk
+    = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_CHUNK,
+                                         &error_code, 0);
+  if (!error_code)
+    {
+      input_error (_("Bad chunk size"));
+      goto exit_on_error;
+    }
+
   // Obtaining pseudo-random numbers generator seed
   input->seed
     = jb_xml_node_get_uint_with_default (node, (const xmlChar *) LABEL_SEED,
@@ -228,6 +338,48 @@ input_open_xml (xmlDoc * doc)   ///< xmlDoc struct.
           goto exit_on_error;
         }
     }
+  else if (!xmlStrcmp (buffer, (const xmlChar *) LABEL_SURROGATE))
+    {
+      input->algorithm = ALGORITHM_SURROGATE;
+
+      // Obtaining simulations number
+      input->nsimulations
+        = jb_xml_node_get_uint (node, (const xmlChar *) LABEL_NSIMULATIONS,
+                                &error_code);
+      if (!error_code || !input->nsimulations)
+        {
+          input_error (_("Bad simulations number"));
+          goto exit_on_error;
+        }
+    }
+  else if (!xmlStrcmp (buffer, (const xmlChar *) LABEL_SOBOL))
+    {
+      input->algorithm = ALGORITHM_SOBOL;
+
+      // Obtaining simulations number
+      input->nsimulations
+        = jb_xml_node_get_uint (node, (const xmlChar *) LABEL_NSIMULATIONS,
+                                &error_code);
+      if (!error_code || !input->nsimulations)
+        {
+          input_error (_("Bad simulations number"));
+          goto exit_on_error;
+        }
+    }
+  else if (!xmlStrcmp (buffer, (const xmlChar *) LABEL_LATIN))
+    {
+      input->algorithm = ALGORITHM_LATIN;
+
+      // Obtaining simulations number
+      input->nsimulations
+        = jb_xml_node_get_uint (node, (const xmlChar *) LABEL_NSIMULATIONS,
+                                &error_code);
+      if (!error_code || !input->nsimulations)
+        {
+          input_error (_("Bad simulations number"));
+          goto exit_on_error;
+        }
+    }
   else if (!xmlStrcmp (buffer, (const xmlChar *) LABEL_SWEEP))
     input->algorithm = ALGORITHM_SWEEP;
   else if (!xmlStrcmp (buffer, (const xmlChar *) LABEL_ORTHOGONAL))
@@ -340,6 +492,44 @@ input_open_xml (xmlDoc * doc)   ///< xmlDoc struct.
           goto exit_on_error;
         }
     }
+  else if (!xmlStrcmp (buffer, (const xmlChar *) LABEL_CMAES))
+    {
+      input->algorithm = ALGORITHM_CMAES;
+      input->nbest = 1;
+
+      // Obtaining population, 0 to set it from the variables number
+      input->nsimulations
+        = jb_xml_node_get_uint_with_default (node,
+                                             (const xmlChar *)
+                                             LABEL_NPOPULATION,
+                                             &error_code, 0);
+      if (!error_code || input->nsimulations == 1)
+        {
+          input_error (_("Invalid population number"));
+          goto exit_on_error;
+        }
+
+      // Obtaining generations
+      input->niterations
+        = jb_xml_node_get_uint (node, (const xmlChar *) LABEL_NGENERATIONS,
+                                &error_code);
+      if (!error_code || !input->niterations)
+        {
+          input_error (_("Invalid generations number"));
+          goto exit_on_error;
+        }
+
+      // Obtaining the number of IPOP restarts
+      input->nrestarts
+        = jb_xml_node_get_uint_with_default (node,
+                                             (const xmlChar *) LABEL_NRESTARTS,
+                                             &error_code, 0);
+      if (!error_code || input->nrestarts > CMAES_MAX_RESTARTS)
+        {
+          input_error (_("Invalid restarts number"));
+          goto exit_on_error;
+        }
+    }
   else
     {
       input_error (_("Unknown algorithm"));
@@ -350,7 +540,10 @@ input_open_xml (xmlDoc * doc)   ///< xmlDoc struct.
 
   if (input->algorithm == ALGORITHM_MONTE_CARLO
       || input->algorithm == ALGORITHM_SWEEP
-      || input->algorithm == ALGORITHM_ORTHOGONAL)
+      || input->algorithm == ALGORITHM_ORTHOGONAL
+      || input->algorithm == ALGORITHM_SURROGATE
+      || input->algorithm == ALGORITHM_SOBOL
+      || input->algorithm == ALGORITHM_LATIN)
     {
 
       // Obtaining iterations number
@@ -433,6 +626,20 @@ input_open_xml (xmlDoc * doc)   ///< xmlDoc struct.
                   goto exit_on_error;
                 }
             }
+          else if (!xmlStrcmp (buffer, (const xmlChar *) LABEL_SIMPLEX))
+            {
+              input->climbing = CLIMBING_METHOD_SIMPLEX;
+              input->nestimates
+                = jb_xml_node_get_uint_with_default (node,
+                                                     (const xmlChar *)
+                                                     LABEL_NESTIMATES,
+                                                     &error_code, 1);
+              if (!error_code || !input->nestimates)
+                {
+                  input_error (_("Invalid estimates number"));
+                  goto exit_on_error;
+                }
+            }
           else
             {
               input_error (_("Unknown method to estimate the hill climbing"));
@@ -451,6 +658,17 @@ input_open_xml (xmlDoc * doc)   ///< xmlDoc struct.
               input_error (_("Invalid relaxation parameter"));
               goto exit_on_error;
             }
+          input->nclimbers
+            = jb_xml_node_get_uint_with_default (node,
+                                                 (const xmlChar *)
+                                                 LABEL_NCLIMBERS,
+                                                 &error_code, 1);
+          if (!error_code || !input->nclimbers
+              || input->nclimbers > input->nbest)
+            {
+              input_error (_("Invalid climbers number"));
+              goto exit_on_error;
+            }
         }
     }
   // Obtaining the threshold
@@ -538,6 +756,14 @@ input_open_xml (xmlDoc * doc)   ///< xmlDoc struct.
       input_error (_("No optimization variables"));
       goto exit_on_error;
     }
+  if (input->algorithm == ALGORITHM_CMAES && !input->nsimulations)
+    input->nsimulations = 4 + (unsigned int) (3. * log (input->nvariables));
+  if (input->algorithm == ALGORITHM_SOBOL
+      && input->nvariables > SOBOL_MAX_NVARIABLES)
+    {
+      input_error (_("Too many variables for the Sobol algorithm"));
+      goto exit_on_error;
+    }
   if (input->nbest > input->nsimulations)
     {
       input_error (_("Best number higher than simulations number"));
@@ -644,9 +870,14 @@ input_open_json (JsonParser * parser)   ///< JsonParser struct.
   else
     input->variables = g_strdup (variables_name);
 
+  // Opening simulator plugin name
+  buffer = json_object_get_string_member (object, LABEL_PLUGIN);
+  if (buffer)
+    input->plugin = g_strdup (buffer);
+
   // Opening simulator program name
   buffer = json_object_get_string_member (object, LABEL_SIMULATOR);
-  if (!buffer)
+  if (!buffer && !input->plugin)
     {
       input_error (_("Bad simulator program"));
       goto exit_on_error;
@@ -663,6 +894,108 @@ input_open_json (JsonParser * parser)   ///< JsonParser struct.
   if (buffer)
     input->cleaner = g_strdup (buffer);
 
+  // Opening evaluation database name
+  buffer = json_object_get_string_member (object, LABEL_DATABASE);
+  if (buffer)
+    input->database = g_strdup (buffer);
+
+  // Obtaining the simulator server mode
+  input->server
+    = jb_json_object_get_uint_with_default (object, LABEL_SERVER,
+                                            &error_code, 0);
+  if (!error_code || input->server > 1 || (input->server && !input->simulator))
+    {
+      input_error (_("Bad simulator server mode"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the TCP port and the number of the worker daemons
+  input->port
+    = jb_json_object_get_uint_with_default (object, LABEL_PORT, &error_code,
+                                            0);
+  if (!error_code || input->port > 65535)
+    {
+      input_error (_("Bad port"));
+      goto exit_on_error;
+    }
+
+  // Checking that only one of the plugin, server and worker daemons modes is
+  // set
+  if ((input->plugin != NULL) + (input->server != 0) + (input->port != 0) > 1)
+    {
+      input_error (_("Incompatible plugin, server and port modes"));
+      goto exit_on_error;
+    }
+  input->workers
+    = jb_json_object_get_uint_with_default (object, LABEL_WORKERS,
+                                            &error_code, 1);
+  if (!error_code || !input->workers)
+    {
+      input_error (_("Bad workers number"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the maximum time waiting for a simulation reply
+  input->timeout
+    = jb_json_object_get_uint_with_default (object, LABEL_TIMEOUT,
+                                            &error_code,
+                                            DEFAULT_SERVER_TIMEOUT);
+  if (!error_code)
+    {
+      input_error (_("Bad timeout"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the evaluation cache mode
+  input->cache
+    = jb_json_object_get_uint_with_default (object, LABEL_CACHE, &error_code,
+                                            0);
+  if (!error_code || input->cache > 1)
+    {
+      input_error (_("Bad evaluation cache mode"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the variables file format
+  input->binary
+    = jb_json_object_get_uint_with_default (object, LABEL_BINARY, &error_code,
+                                            0);
+  if (!error_code || input->binary > 1)
+    {
+      input_error (_("Bad variables file format"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the pruning mode
+  input->prune
+    = jb_json_object_get_uint_with_default (object, LABEL_PRUNE, &error_code,
+                                            0);
+  if (!error_code || input->prune > 1)
+    {
+      input_error (_("Bad pruning mode"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the pipelined iterations fraction
+  input->pipeline
+    = jb_json_object_get_float_with_default (object, LABEL_PIPELINE,
+                                             &error_code, DEFAULT_PIPELINE);
+  if (!error_code || input->pipeline <= 0. || input->pipeline > 1.)
+    {
+      input_error (_("Bad pipeline fraction"));
+      goto exit_on_error;
+    }
+
+  // Obtaining the chunk size of the dynamic MPI scheduling
+  input->chunk
+    = jb_json_object_get_uint_with_default (object, LABEL_CHUNK, &error_code,
+                                            0);
+  if (!error_code)
+    {
+      input_error (_("Bad chunk size"));
+      goto exit_on_error;
+    }
+
   // Obtaining pseudo-random numbers generator seed
   input->seed
     = jb_json_object_get_uint_with_default (object, LABEL_SEED,
@@ -688,6 +1021,45 @@ input_open_json (JsonParser * parser)   ///< JsonParser struct.
           goto exit_on_error;
         }
     }
+  else if (!strcmp (buffer, LABEL_SURROGATE))
+    {
+      input->algorithm = ALGORITHM_SURROGATE;
+
+      // Obtaining simulations number
+      input->nsimulations
+        = jb_json_object_get_uint (object, LABEL_NSIMULATIONS, &error_code);
+      if (!error_code || !input->nsimulations)
+        {
+          input_error (_("Bad simulations number"));
+          goto exit_on_error;
+        }
+    }
+  else if (!strcmp (buffer, LABEL_SOBOL))
+    {
+      input->algorithm = ALGORITHM_SOBOL;
+
+      // Obtaining simulations number
+      input->nsimulations
+        = jb_json_object_get_uint (object, LABEL_NSIMULATIONS, &error_code);
+      if (!error_code || !input->nsimulations)
+        {
+          input_error (_("Bad simulations number"));
+          goto exit_on_error;
+        }
+    }
+  else if (!strcmp (buffer, LABEL_LATIN))
+    {
+      input->algorithm = ALGORITHM_LATIN;
+
+      // Obtaining simulations number
+      input->nsimulations
+        = jb_json_object_get_uint (object, LABEL_NSIMULATIONS, &error_code);
+      if (!error_code || !input->nsimulations)
+        {
+          input_error (_("Bad simulations number"));
+          goto exit_on_error;
+        }
+    }
   else if (!strcmp (buffer, LABEL_SWEEP))
     input->algorithm = ALGORITHM_SWEEP;
   else if (!strcmp (buffer, LABEL_ORTHOGONAL))
@@ -797,6 +1169,40 @@ input_open_json (JsonParser * parser)   ///< JsonParser struct.
           goto exit_on_error;
         }
     }
+  else if (!strcmp (buffer, LABEL_CMAES))
+    {
+      input->algorithm = ALGORITHM_CMAES;
+      input->nbest = 1;
+
+      // Obtaining population, 0 to set it from the variables number
+      input->nsimulations
+        = jb_json_object_get_uint_with_default (object, LABEL_NPOPULATION,
+                                                &error_code, 0);
+      if (!error_code || input->nsimulations == 1)
+        {
+          input_error (_("Invalid population number"));
+          goto exit_on_error;
+        }
+
+      // Obtaining generations
+      input->niterations
+        = jb_json_object_get_uint (object, LABEL_NGENERATIONS, &error_code);
+      if (!error_code || !input->niterations)
+        {
+          input_error (_("Invalid generations number"));
+          goto exit_on_error;
+        }
+
+      // Obtaining the number of IPOP restarts
+      input->nrestarts
+        = jb_json_object_get_uint_with_default (object, LABEL_NRESTARTS,
+                                                &error_code, 0);
+      if (!error_code || input->nrestarts > CMAES_MAX_RESTARTS)
+        {
+          input_error (_("Invalid restarts number"));
+          goto exit_on_error;
+        }
+    }
   else
     {
       input_error (_("Unknown algorithm"));
@@ -805,7 +1211,10 @@ input_open_json (JsonParser * parser)   ///< JsonParser struct.
 
   if (input->algorithm == ALGORITHM_MONTE_CARLO
       || input->algorithm == ALGORITHM_SWEEP
-      || input->algorithm == ALGORITHM_ORTHOGONAL)
+      || input->algorithm == ALGORITHM_ORTHOGONAL
+      || input->algorithm == ALGORITHM_SURROGATE
+      || input->algorithm == ALGORITHM_SOBOL
+      || input->algorithm == ALGORITHM_LATIN)
     {
 
       // Obtaining iterations number
@@ -875,6 +1284,19 @@ input_open_json (JsonParser * parser)   ///< JsonParser struct.
                   goto exit_on_error;
                 }
             }
+          else if (!strcmp (buffer, LABEL_SIMPLEX))
+            {
+              input->climbing = CLIMBING_METHOD_SIMPLEX;
+              input->nestimates
+                = jb_json_object_get_uint_with_default (object,
+                                                        LABEL_NESTIMATES,
+                                                        &error_code, 1);
+              if (!error_code || !input->nestimates)
+                {
+                  input_error (_("Invalid estimates number"));
+                  goto exit_on_error;
+                }
+            }
           else
             {
               input_error (_("Unknown method to estimate the hill climbing"));
@@ -889,6 +1311,15 @@ input_open_json (JsonParser * parser)   ///< JsonParser struct.
               input_error (_("Invalid relaxation parameter"));
               goto exit_on_error;
             }
+          input->nclimbers
+            = jb_json_object_get_uint_with_default (object, LABEL_NCLIMBERS,
+                                                    &error_code, 1);
+          if (!error_code || !input->nclimbers
+              || input->nclimbers > input->nbest)
+            {
+              input_error (_("Invalid climbers number"));
+              goto exit_on_error;
+            }
         }
       else
         input->nsteps = input->nfinal_steps = 0;
@@ -966,6 +1397,14 @@ input_open_json (JsonParser * parser)   ///< JsonParser struct.
       input_error (_("No optimization variables"));
       goto exit_on_error;
     }
+  if (input->algorithm == ALGORITHM_CMAES && !input->nsimulations)
+    input->nsimulations = 4 + (unsigned int) (3. * log (input->nvariables));
+  if (input->algorithm == ALGORITHM_SOBOL
+      && input->nvariables > SOBOL_MAX_NVARIABLES)
+    {
+      input_error (_("Too many variables for the Sobol algorithm"));
+      goto exit_on_error;
+    }
 
   // Obtaining the error norm
   if (json_object_get_member (object, LABEL_NORM))
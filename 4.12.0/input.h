@@ -43,6 +43,7 @@ enum ClimbingMethod
 {
   CLIMBING_METHOD_COORDINATES = 0,      ///< Coordinates hill climbing method.
   CLIMBING_METHOD_RANDOM = 1,   ///< Random hill climbing method.
+  CLIMBING_METHOD_SIMPLEX = 2,  ///< Parallel Nelder-Mead simplex method.
 };
 
 ///> Enum to define the error norm.
@@ -69,9 +70,11 @@ typedef struct
   char *result;                 ///< Name of the result file.
   char *variables;              ///< Name of the variables file.
   char *simulator;              ///< Name of the simulator program.
+  char *plugin;                 ///< Name of the simulator plugin.
   char *evaluator;
   ///< Name of the program to evaluate the objective function.
   char *cleaner;                ///< Name of the cleaner program.
+  char *database;               ///< Name of the evaluation database file.
   char *directory;              ///< Working directory.
   char *name;                   ///< Input data file name.
   double tolerance;             ///< Algorithm tolerance.
@@ -81,6 +84,8 @@ typedef struct
   double relaxation;            ///< Relaxation parameter.
   double p;                     ///< Exponent of the P error norm.
   double threshold;             ///< Threshold to finish the optimization.
+  double pipeline;
+  ///< Fraction of finished simulations to start the next pipelined iteration.
   unsigned long int seed;
   ///< Seed of the pseudo-random numbers generator.
   unsigned int nvariables;      ///< Variables number.
@@ -94,11 +99,30 @@ typedef struct
   unsigned int climbing;        ///< Method to estimate the hill climbing.
   unsigned int nestimates;
   ///< Number of simulations to estimate the hill climbing.
+  unsigned int nclimbers;
+  ///< Number of hill climbing methods started from the best simulations.
   unsigned int niterations;     ///< Number of algorithm iterations
+  unsigned int nrestarts;       ///< Number of IPOP restarts of CMA-ES.
   unsigned int nbest;           ///< Number of best simulations.
   unsigned int norm;            ///< Error norm type.
   unsigned int type;            ///< Type of input file.
   unsigned int template_flags;  ///< Flags of template files.
+  unsigned int server;
+  ///< 1 to run the simulator as a persistent server, 0 otherwise.
+  unsigned int cache;
+  ///< 1 to cache the evaluations of identical simulations, 0 otherwise.
+  unsigned int binary;
+  ///< 1 to write the variables file in binary format, 0 otherwise.
+  unsigned int prune;
+  ///< 1 to prune the simulations not entering the best set, 0 otherwise.
+  unsigned int chunk;
+  ///< Number of simulations of the chunks of the dynamic MPI scheduling.
+  unsigned int port;
+  ///< TCP port to wait for the worker daemons, 0 to simulate locally.
+  unsigned int workers;         ///< Number of worker daemons to wait for.
+  unsigned int timeout;
+  ///< Maximum time in seconds waiting for a simulator server or worker daemon
+  ///< reply, 0 to wait forever.
 } Input;
 
 extern Input input[1];
@@ -63,6 +63,9 @@ OF SUCH DAMAGE.
 #include "experiment.h"
 #include "variable.h"
 #include "input.h"
+#include "template.h"
+#include "database.h"
+#include "best.h"
 #include "optimize.h"
 #include "interface.h"
 
@@ -181,12 +184,22 @@ input_save_climbing_xml (xmlNode * node)        ///< XML node.
       if (input->relaxation != DEFAULT_RELAXATION)
         jb_xml_node_set_float (node, (const xmlChar *) LABEL_RELAXATION,
                                input->relaxation);
+      if (input->nclimbers != 1)
+        jb_xml_node_set_uint (node, (const xmlChar *) LABEL_NCLIMBERS,
+                              input->nclimbers);
       switch (input->climbing)
         {
         case CLIMBING_METHOD_COORDINATES:
           xmlSetProp (node, (const xmlChar *) LABEL_CLIMBING,
                       (const xmlChar *) LABEL_COORDINATES);
           break;
+        case CLIMBING_METHOD_SIMPLEX:
+          xmlSetProp (node, (const xmlChar *) LABEL_CLIMBING,
+                      (const xmlChar *) LABEL_SIMPLEX);
+          if (input->nestimates != 1)
+            jb_xml_node_set_uint (node, (const xmlChar *) LABEL_NESTIMATES,
+                                  input->nestimates);
+          break;
         default:
           xmlSetProp (node, (const xmlChar *) LABEL_CLIMBING,
                       (const xmlChar *) LABEL_RANDOM);
@@ -215,12 +228,21 @@ input_save_climbing_json (JsonNode * node)      ///< JSON node.
       jb_json_object_set_uint (object, LABEL_NSTEPS, input->nsteps);
       if (input->relaxation != DEFAULT_RELAXATION)
         jb_json_object_set_float (object, LABEL_RELAXATION, input->relaxation);
+      if (input->nclimbers != 1)
+        jb_json_object_set_uint (object, LABEL_NCLIMBERS, input->nclimbers);
       switch (input->climbing)
         {
         case CLIMBING_METHOD_COORDINATES:
           json_object_set_string_member (object, LABEL_CLIMBING,
                                          LABEL_COORDINATES);
           break;
+        case CLIMBING_METHOD_SIMPLEX:
+          json_object_set_string_member (object, LABEL_CLIMBING,
+                                         LABEL_SIMPLEX);
+          if (input->nestimates != 1)
+            jb_json_object_set_uint (object, LABEL_NESTIMATES,
+                                     input->nestimates);
+          break;
         default:
           json_object_set_string_member (object, LABEL_CLIMBING, LABEL_RANDOM);
           jb_json_object_set_uint (object, LABEL_NESTIMATES, input->nestimates);
@@ -260,11 +282,23 @@ input_save_xml (xmlDoc * doc)   ///< xmlDoc struct.
     xmlSetProp (node, (const xmlChar *) LABEL_VARIABLES_FILE,
                 (xmlChar *) input->variables);
   file = g_file_new_for_path (input->directory);
-  file2 = g_file_new_for_path (input->simulator);
-  buffer = g_file_get_relative_path (file, file2);
-  g_object_unref (file2);
-  xmlSetProp (node, (const xmlChar *) LABEL_SIMULATOR, (xmlChar *) buffer);
-  g_free (buffer);
+  if (input->simulator)
+    {
+      file2 = g_file_new_for_path (input->simulator);
+      buffer = g_file_get_relative_path (file, file2);
+      g_object_unref (file2);
+      xmlSetProp (node, (const xmlChar *) LABEL_SIMULATOR, (xmlChar *) buffer);
+      g_free (buffer);
+    }
+  if (input->plugin)
+    {
+      file2 = g_file_new_for_path (input->plugin);
+      buffer = g_file_get_relative_path (file, file2);
+      g_object_unref (file2);
+      if (xmlStrlen ((xmlChar *) buffer))
+        xmlSetProp (node, (const xmlChar *) LABEL_PLUGIN, (xmlChar *) buffer);
+      g_free (buffer);
+    }
   if (input->evaluator)
     {
       file2 = g_file_new_for_path (input->evaluator);
@@ -284,6 +318,33 @@ input_save_xml (xmlDoc * doc)   ///< xmlDoc struct.
         xmlSetProp (node, (const xmlChar *) LABEL_CLEANER, (xmlChar *) buffer);
       g_free (buffer);
     }
+  if (input->server)
+    jb_xml_node_set_uint (node, (const xmlChar *) LABEL_SERVER, input->server);
+  if (input->port)
+    {
+      jb_xml_node_set_uint (node, (const xmlChar *) LABEL_PORT, input->port);
+      if (input->workers != 1)
+        jb_xml_node_set_uint (node, (const xmlChar *) LABEL_WORKERS,
+                              input->workers);
+    }
+  if ((input->server || input->port)
+      && input->timeout != DEFAULT_SERVER_TIMEOUT)
+    jb_xml_node_set_uint (node, (const xmlChar *) LABEL_TIMEOUT,
+                          input->timeout);
+  if (input->cache)
+    jb_xml_node_set_uint (node, (const xmlChar *) LABEL_CACHE, input->cache);
+  if (input->binary)
+    jb_xml_node_set_uint (node, (const xmlChar *) LABEL_BINARY, input->binary);
+  if (input->prune)
+    jb_xml_node_set_uint (node, (const xmlChar *) LABEL_PRUNE, input->prune);
+  if (input->chunk)
+    jb_xml_node_set_uint (node, (const xmlChar *) LABEL_CHUNK, input->chunk);
+  if (input->pipeline != DEFAULT_PIPELINE)
+    jb_xml_node_set_float (node, (const xmlChar *) LABEL_PIPELINE,
+                           input->pipeline);
+  if (input->database)
+    xmlSetProp (node, (const xmlChar *) LABEL_DATABASE,
+                (xmlChar *) input->database);
   if (input->seed != DEFAULT_RANDOM_SEED)
     jb_xml_node_set_uint (node, (const xmlChar *) LABEL_SEED, input->seed);
 
@@ -306,6 +367,51 @@ input_save_xml (xmlDoc * doc)   ///< xmlDoc struct.
       xmlSetProp (node, (const xmlChar *) LABEL_NBEST, (xmlChar *) buffer);
       input_save_climbing_xml (node);
       break;
+    case ALGORITHM_SURROGATE:
+      xmlSetProp (node, (const xmlChar *) LABEL_ALGORITHM,
+                  (const xmlChar *) LABEL_SURROGATE);
+      snprintf (buffer, 64, "%u", input->nsimulations);
+      xmlSetProp (node, (const xmlChar *) LABEL_NSIMULATIONS,
+                  (xmlChar *) buffer);
+      snprintf (buffer, 64, "%u", input->niterations);
+      xmlSetProp (node, (const xmlChar *) LABEL_NITERATIONS,
+                  (xmlChar *) buffer);
+      snprintf (buffer, 64, "%.3lg", input->tolerance);
+      xmlSetProp (node, (const xmlChar *) LABEL_TOLERANCE, (xmlChar *) buffer);
+      snprintf (buffer, 64, "%u", input->nbest);
+      xmlSetProp (node, (const xmlChar *) LABEL_NBEST, (xmlChar *) buffer);
+      input_save_climbing_xml (node);
+      break;
+    case ALGORITHM_SOBOL:
+      xmlSetProp (node, (const xmlChar *) LABEL_ALGORITHM,
+                  (const xmlChar *) LABEL_SOBOL);
+      snprintf (buffer, 64, "%u", input->nsimulations);
+      xmlSetProp (node, (const xmlChar *) LABEL_NSIMULATIONS,
+                  (xmlChar *) buffer);
+      snprintf (buffer, 64, "%u", input->niterations);
+      xmlSetProp (node, (const xmlChar *) LABEL_NITERATIONS,
+                  (xmlChar *) buffer);
+      snprintf (buffer, 64, "%.3lg", input->tolerance);
+      xmlSetProp (node, (const xmlChar *) LABEL_TOLERANCE, (xmlChar *) buffer);
+      snprintf (buffer, 64, "%u", input->nbest);
+      xmlSetProp (node, (const xmlChar *) LABEL_NBEST, (xmlChar *) buffer);
+      input_save_climbing_xml (node);
+      break;
+    case ALGORITHM_LATIN:
+      xmlSetProp (node, (const xmlChar *) LABEL_ALGORITHM,
+                  (const xmlChar *) LABEL_LATIN);
+      snprintf (buffer, 64, "%u", input->nsimulations);
+      xmlSetProp (node, (const xmlChar *) LABEL_NSIMULATIONS,
+                  (xmlChar *) buffer);
+      snprintf (buffer, 64, "%u", input->niterations);
+      xmlSetProp (node, (const xmlChar *) LABEL_NITERATIONS,
+                  (xmlChar *) buffer);
+      snprintf (buffer, 64, "%.3lg", input->tolerance);
+      xmlSetProp (node, (const xmlChar *) LABEL_TOLERANCE, (xmlChar *) buffer);
+      snprintf (buffer, 64, "%u", input->nbest);
+      xmlSetProp (node, (const xmlChar *) LABEL_NBEST, (xmlChar *) buffer);
+      input_save_climbing_xml (node);
+      break;
     case ALGORITHM_SWEEP:
       xmlSetProp (node, (const xmlChar *) LABEL_ALGORITHM,
                   (const xmlChar *) LABEL_SWEEP);
@@ -330,6 +436,19 @@ input_save_xml (xmlDoc * doc)   ///< xmlDoc struct.
       xmlSetProp (node, (const xmlChar *) LABEL_NBEST, (xmlChar *) buffer);
       input_save_climbing_xml (node);
       break;
+    case ALGORITHM_CMAES:
+      xmlSetProp (node, (const xmlChar *) LABEL_ALGORITHM,
+                  (const xmlChar *) LABEL_CMAES);
+      snprintf (buffer, 64, "%u", input->nsimulations);
+      xmlSetProp (node, (const xmlChar *) LABEL_NPOPULATION,
+                  (xmlChar *) buffer);
+      snprintf (buffer, 64, "%u", input->niterations);
+      xmlSetProp (node, (const xmlChar *) LABEL_NGENERATIONS,
+                  (xmlChar *) buffer);
+      if (input->nrestarts)
+        jb_xml_node_set_uint (node, (const xmlChar *) LABEL_NRESTARTS,
+                              input->nrestarts);
+      break;
     default:
       xmlSetProp (node, (const xmlChar *) LABEL_ALGORITHM,
                   (const xmlChar *) LABEL_GENETIC);
@@ -450,11 +569,23 @@ input_save_json (JsonGenerator * generator)     ///< JsonGenerator struct.
     json_object_set_string_member (object, LABEL_VARIABLES_FILE,
                                    input->variables);
   file = g_file_new_for_path (input->directory);
-  file2 = g_file_new_for_path (input->simulator);
-  buffer = g_file_get_relative_path (file, file2);
-  g_object_unref (file2);
-  json_object_set_string_member (object, LABEL_SIMULATOR, buffer);
-  g_free (buffer);
+  if (input->simulator)
+    {
+      file2 = g_file_new_for_path (input->simulator);
+      buffer = g_file_get_relative_path (file, file2);
+      g_object_unref (file2);
+      json_object_set_string_member (object, LABEL_SIMULATOR, buffer);
+      g_free (buffer);
+    }
+  if (input->plugin)
+    {
+      file2 = g_file_new_for_path (input->plugin);
+      buffer = g_file_get_relative_path (file, file2);
+      g_object_unref (file2);
+      if (strlen (buffer))
+        json_object_set_string_member (object, LABEL_PLUGIN, buffer);
+      g_free (buffer);
+    }
   if (input->evaluator)
     {
       file2 = g_file_new_for_path (input->evaluator);
@@ -473,6 +604,29 @@ input_save_json (JsonGenerator * generator)     ///< JsonGenerator struct.
         json_object_set_string_member (object, LABEL_CLEANER, buffer);
       g_free (buffer);
     }
+  if (input->server)
+    jb_json_object_set_uint (object, LABEL_SERVER, input->server);
+  if (input->port)
+    {
+      jb_json_object_set_uint (object, LABEL_PORT, input->port);
+      if (input->workers != 1)
+        jb_json_object_set_uint (object, LABEL_WORKERS, input->workers);
+    }
+  if ((input->server || input->port)
+      && input->timeout != DEFAULT_SERVER_TIMEOUT)
+    jb_json_object_set_uint (object, LABEL_TIMEOUT, input->timeout);
+  if (input->cache)
+    jb_json_object_set_uint (object, LABEL_CACHE, input->cache);
+  if (input->binary)
+    jb_json_object_set_uint (object, LABEL_BINARY, input->binary);
+  if (input->prune)
+    jb_json_object_set_uint (object, LABEL_PRUNE, input->prune);
+  if (input->chunk)
+    jb_json_object_set_uint (object, LABEL_CHUNK, input->chunk);
+  if (input->pipeline != DEFAULT_PIPELINE)
+    jb_json_object_set_float (object, LABEL_PIPELINE, input->pipeline);
+  if (input->database)
+    json_object_set_string_member (object, LABEL_DATABASE, input->database);
   if (input->seed != DEFAULT_RANDOM_SEED)
     jb_json_object_set_uint (object, LABEL_SEED, input->seed);
 
@@ -493,6 +647,43 @@ input_save_json (JsonGenerator * generator)     ///< JsonGenerator struct.
       json_object_set_string_member (object, LABEL_NBEST, buffer);
       input_save_climbing_json (node);
       break;
+    case ALGORITHM_SURROGATE:
+      json_object_set_string_member (object, LABEL_ALGORITHM,
+                                     LABEL_SURROGATE);
+      snprintf (buffer, 64, "%u", input->nsimulations);
+      json_object_set_string_member (object, LABEL_NSIMULATIONS, buffer);
+      snprintf (buffer, 64, "%u", input->niterations);
+      json_object_set_string_member (object, LABEL_NITERATIONS, buffer);
+      snprintf (buffer, 64, "%.3lg", input->tolerance);
+      json_object_set_string_member (object, LABEL_TOLERANCE, buffer);
+      snprintf (buffer, 64, "%u", input->nbest);
+      json_object_set_string_member (object, LABEL_NBEST, buffer);
+      input_save_climbing_json (node);
+      break;
+    case ALGORITHM_SOBOL:
+      json_object_set_string_member (object, LABEL_ALGORITHM, LABEL_SOBOL);
+      snprintf (buffer, 64, "%u", input->nsimulations);
+      json_object_set_string_member (object, LABEL_NSIMULATIONS, buffer);
+      snprintf (buffer, 64, "%u", input->niterations);
+      json_object_set_string_member (object, LABEL_NITERATIONS, buffer);
+      snprintf (buffer, 64, "%.3lg", input->tolerance);
+      json_object_set_string_member (object, LABEL_TOLERANCE, buffer);
+      snprintf (buffer, 64, "%u", input->nbest);
+      json_object_set_string_member (object, LABEL_NBEST, buffer);
+      input_save_climbing_json (node);
+      break;
+    case ALGORITHM_LATIN:
+      json_object_set_string_member (object, LABEL_ALGORITHM, LABEL_LATIN);
+      snprintf (buffer, 64, "%u", input->nsimulations);
+      json_object_set_string_member (object, LABEL_NSIMULATIONS, buffer);
+      snprintf (buffer, 64, "%u", input->niterations);
+      json_object_set_string_member (object, LABEL_NITERATIONS, buffer);
+      snprintf (buffer, 64, "%.3lg", input->tolerance);
+      json_object_set_string_member (object, LABEL_TOLERANCE, buffer);
+      snprintf (buffer, 64, "%u", input->nbest);
+      json_object_set_string_member (object, LABEL_NBEST, buffer);
+      input_save_climbing_json (node);
+      break;
     case ALGORITHM_SWEEP:
       json_object_set_string_member (object, LABEL_ALGORITHM, LABEL_SWEEP);
       snprintf (buffer, 64, "%u", input->niterations);
@@ -513,6 +704,15 @@ input_save_json (JsonGenerator * generator)     ///< JsonGenerator struct.
       json_object_set_string_member (object, LABEL_NBEST, buffer);
       input_save_climbing_json (node);
       break;
+    case ALGORITHM_CMAES:
+      json_object_set_string_member (object, LABEL_ALGORITHM, LABEL_CMAES);
+      snprintf (buffer, 64, "%u", input->nsimulations);
+      json_object_set_string_member (object, LABEL_NPOPULATION, buffer);
+      snprintf (buffer, 64, "%u", input->niterations);
+      json_object_set_string_member (object, LABEL_NGENERATIONS, buffer);
+      if (input->nrestarts)
+        jb_json_object_set_uint (object, LABEL_NRESTARTS, input->nrestarts);
+      break;
     default:
       json_object_set_string_member (object, LABEL_ALGORITHM, LABEL_GENETIC);
       snprintf (buffer, 64, "%u", input->nsimulations);
@@ -852,6 +1052,11 @@ window_save_climbing ()
         case CLIMBING_METHOD_COORDINATES:
           input->climbing = CLIMBING_METHOD_COORDINATES;
           break;
+        case CLIMBING_METHOD_SIMPLEX:
+          input->climbing = CLIMBING_METHOD_SIMPLEX;
+          input->nestimates
+            = gtk_spin_button_get_value_as_int (window->spin_estimates);
+          break;
         default:
           input->climbing = CLIMBING_METHOD_RANDOM;
           input->nestimates
@@ -931,6 +1136,36 @@ dialog_save_close (GtkFileChooserDialog * dlg,
           input->nbest = gtk_spin_button_get_value_as_int (window->spin_bests);
           window_save_climbing ();
           break;
+        case ALGORITHM_SURROGATE:
+          input->algorithm = ALGORITHM_SURROGATE;
+          input->nsimulations
+            = gtk_spin_button_get_value_as_int (window->spin_simulations);
+          input->niterations
+            = gtk_spin_button_get_value_as_int (window->spin_iterations);
+          input->tolerance = gtk_spin_button_get_value (window->spin_tolerance);
+          input->nbest = gtk_spin_button_get_value_as_int (window->spin_bests);
+          window_save_climbing ();
+          break;
+        case ALGORITHM_SOBOL:
+          input->algorithm = ALGORITHM_SOBOL;
+          input->nsimulations
+            = gtk_spin_button_get_value_as_int (window->spin_simulations);
+          input->niterations
+            = gtk_spin_button_get_value_as_int (window->spin_iterations);
+          input->tolerance = gtk_spin_button_get_value (window->spin_tolerance);
+          input->nbest = gtk_spin_button_get_value_as_int (window->spin_bests);
+          window_save_climbing ();
+          break;
+        case ALGORITHM_LATIN:
+          input->algorithm = ALGORITHM_LATIN;
+          input->nsimulations
+            = gtk_spin_button_get_value_as_int (window->spin_simulations);
+          input->niterations
+            = gtk_spin_button_get_value_as_int (window->spin_iterations);
+          input->tolerance = gtk_spin_button_get_value (window->spin_tolerance);
+          input->nbest = gtk_spin_button_get_value_as_int (window->spin_bests);
+          window_save_climbing ();
+          break;
         case ALGORITHM_SWEEP:
           input->algorithm = ALGORITHM_SWEEP;
           input->niterations
@@ -947,6 +1182,16 @@ dialog_save_close (GtkFileChooserDialog * dlg,
           input->nbest = gtk_spin_button_get_value_as_int (window->spin_bests);
           window_save_climbing ();
           break;
+        case ALGORITHM_CMAES:
+          input->algorithm = ALGORITHM_CMAES;
+          input->nsimulations
+            = gtk_spin_button_get_value_as_int (window->spin_population);
+          input->niterations
+            = gtk_spin_button_get_value_as_int (window->spin_generations);
+          input->nrestarts
+            = gtk_spin_button_get_value_as_int (window->spin_restarts);
+          input->nbest = 1;
+          break;
         default:
           input->algorithm = ALGORITHM_GENETIC;
           input->nsimulations
@@ -1051,12 +1296,14 @@ window_run ()
   window_save ();
   running_new ();
   jbw_process_pending ();
-  optimize_open ();
+  i = optimize_open ();
 #if DEBUG_INTERFACE
   fprintf (stderr, "window_run: closing running dialog\n");
 #endif
   gtk_spinner_stop (running->spinner);
   gtk_window_destroy (GTK_WINDOW (running->dialog));
+  if (!i)
+    goto window_run_end;
 #if DEBUG_INTERFACE
   fprintf (stderr, "window_run: displaying results\n");
 #endif
@@ -1076,6 +1323,7 @@ window_run ()
   g_free (msg2);
   jbw_show_message_gtk (_("Best result"), msg, INFO_TYPE);
   g_free (msg);
+window_run_end:
 #if DEBUG_INTERFACE
   fprintf (stderr, "window_run: freeing memory\n");
 #endif
@@ -1208,6 +1456,8 @@ window_update ()
   gtk_widget_hide (GTK_WIDGET (window->spin_population));
   gtk_widget_hide (GTK_WIDGET (window->label_generations));
   gtk_widget_hide (GTK_WIDGET (window->spin_generations));
+  gtk_widget_hide (GTK_WIDGET (window->label_restarts));
+  gtk_widget_hide (GTK_WIDGET (window->spin_restarts));
   gtk_widget_hide (GTK_WIDGET (window->label_mutation));
   gtk_widget_hide (GTK_WIDGET (window->spin_mutation));
   gtk_widget_hide (GTK_WIDGET (window->label_reproduction));
@@ -1228,6 +1478,9 @@ window_update ()
   switch (window_get_algorithm ())
     {
     case ALGORITHM_MONTE_CARLO:
+    case ALGORITHM_SURROGATE:
+    case ALGORITHM_SOBOL:
+    case ALGORITHM_LATIN:
       gtk_widget_show (GTK_WIDGET (window->label_simulations));
       gtk_widget_show (GTK_WIDGET (window->spin_simulations));
       gtk_widget_show (GTK_WIDGET (window->label_iterations));
@@ -1257,6 +1510,14 @@ window_update ()
       gtk_widget_show (GTK_WIDGET (window->check_climbing));
       window_update_climbing ();
       break;
+    case ALGORITHM_CMAES:
+      gtk_widget_show (GTK_WIDGET (window->label_population));
+      gtk_widget_show (GTK_WIDGET (window->spin_population));
+      gtk_widget_show (GTK_WIDGET (window->label_generations));
+      gtk_widget_show (GTK_WIDGET (window->spin_generations));
+      gtk_widget_show (GTK_WIDGET (window->label_restarts));
+      gtk_widget_show (GTK_WIDGET (window->spin_restarts));
+      break;
     default:
       gtk_widget_show (GTK_WIDGET (window->label_population));
       gtk_widget_show (GTK_WIDGET (window->spin_population));
@@ -2015,6 +2276,9 @@ window_read (char *filename)    ///< File name.
   switch (input->algorithm)
     {
     case ALGORITHM_MONTE_CARLO:
+    case ALGORITHM_SURROGATE:
+    case ALGORITHM_SOBOL:
+    case ALGORITHM_LATIN:
       gtk_spin_button_set_value (window->spin_simulations,
                                  (gdouble) input->nsimulations);
       // fallthrough
@@ -2038,11 +2302,20 @@ window_read (char *filename)    ///< File name.
           switch (input->climbing)
             {
             case CLIMBING_METHOD_RANDOM:
+            case CLIMBING_METHOD_SIMPLEX:
               gtk_spin_button_set_value (window->spin_estimates,
                                          (gdouble) input->nestimates);
             }
         }
       break;
+    case ALGORITHM_CMAES:
+      gtk_spin_button_set_value (window->spin_population,
+                                 (gdouble) input->nsimulations);
+      gtk_spin_button_set_value (window->spin_generations,
+                                 (gdouble) input->niterations);
+      gtk_spin_button_set_value (window->spin_restarts,
+                                 (gdouble) input->nrestarts);
+      break;
     default:
       gtk_spin_button_set_value (window->spin_population,
                                  (gdouble) input->nsimulations);
@@ -2365,20 +2638,26 @@ window_new (GtkApplication * application)       ///< GtkApplication struct.
   unsigned int i;
   char *buffer, *buffer2, buffer3[64];
   const char *label_algorithm[NALGORITHMS] = {
-    "_Monte-Carlo", _("_Sweep"), _("_Genetic"), _("_Orthogonal")
+    "_Monte-Carlo", _("_Sweep"), _("_Genetic"), _("_Orthogonal"),
+    _("S_urrogate"), _("_CMA-ES"), _("So_bol"), _("_Latin hypercube")
   };
   const char *tip_algorithm[NALGORITHMS] = {
     _("Monte-Carlo brute force algorithm"),
     _("Sweep brute force algorithm"),
     _("Genetic algorithm"),
     _("Orthogonal sampling brute force algorithm"),
+    _("Surrogate model assisted algorithm"),
+    _("Covariance matrix adaptation evolution strategy"),
+    _("Scrambled Sobol quasi-random sampling algorithm"),
+    _("Latin hypercube sampling algorithm"),
   };
   const char *label_climbing[NCLIMBINGS] = {
-    _("_Coordinates climbing"), _("_Random climbing")
+    _("_Coordinates climbing"), _("_Random climbing"), _("_Simplex climbing")
   };
   const char *tip_climbing[NCLIMBINGS] = {
     _("Coordinates climbing estimate method"),
-    _("Random climbing estimate method")
+    _("Random climbing estimate method"),
+    _("Parallel Nelder-Mead simplex method")
   };
   const char *label_norm[NNORMS] = { "L2", "L∞", "Lp", "L1" };
   const char *tip_norm[NNORMS] = {
@@ -2609,6 +2888,12 @@ window_new (GtkApplication * application)       ///< GtkApplication struct.
   gtk_widget_set_tooltip_text
     (GTK_WIDGET (window->spin_generations),
      _("Number of generations for the genetic algorithm"));
+  window->label_restarts = (GtkLabel *) gtk_label_new (_("Restarts number"));
+  window->spin_restarts = (GtkSpinButton *)
+    gtk_spin_button_new_with_range (0., (gdouble) CMAES_MAX_RESTARTS, 1.);
+  gtk_widget_set_tooltip_text
+    (GTK_WIDGET (window->spin_restarts),
+     _("Number of restarts doubling the population for the CMA-ES algorithm"));
   window->label_mutation = (GtkLabel *) gtk_label_new (_("Mutation ratio"));
   window->spin_mutation
     = (GtkSpinButton *) gtk_spin_button_new_with_range (0., 1., 0.001);
@@ -2796,15 +3081,19 @@ window_new (GtkApplication * application)       ///< GtkApplication struct.
                    0, NALGORITHMS + 8, 1, 1);
   gtk_grid_attach (window->grid_algorithm, GTK_WIDGET (window->spin_adaptation),
                    1, NALGORITHMS + 8, 1, 1);
+  gtk_grid_attach (window->grid_algorithm, GTK_WIDGET (window->label_restarts),
+                   0, NALGORITHMS + 9, 1, 1);
+  gtk_grid_attach (window->grid_algorithm, GTK_WIDGET (window->spin_restarts),
+                   1, NALGORITHMS + 9, 1, 1);
   gtk_grid_attach (window->grid_algorithm, GTK_WIDGET (window->check_climbing),
-                   0, NALGORITHMS + 9, 2, 1);
-  gtk_grid_attach (window->grid_algorithm, GTK_WIDGET (window->grid_climbing),
                    0, NALGORITHMS + 10, 2, 1);
+  gtk_grid_attach (window->grid_algorithm, GTK_WIDGET (window->grid_climbing),
+                   0, NALGORITHMS + 11, 2, 1);
   gtk_grid_attach (window->grid_algorithm, GTK_WIDGET (window->label_threshold),
-                   0, NALGORITHMS + 11, 1, 1);
+                   0, NALGORITHMS + 12, 1, 1);
   gtk_grid_attach (window->grid_algorithm,
                    GTK_WIDGET (window->scrolled_threshold),
-                   1, NALGORITHMS + 11, 1, 1);
+                   1, NALGORITHMS + 12, 1, 1);
   window->frame_algorithm = (GtkFrame *) gtk_frame_new (_("Algorithm"));
   gtk_frame_set_child (window->frame_algorithm,
                        GTK_WIDGET (window->grid_algorithm));
@@ -136,6 +136,9 @@ typedef struct
   GtkLabel *label_generations;  ///< GtkLabel to set the generations number.
   GtkSpinButton *spin_generations;
   ///< GtkSpinButton to set the generations number.
+  GtkLabel *label_restarts;     ///< GtkLabel to set the restarts number.
+  GtkSpinButton *spin_restarts;
+  ///< GtkSpinButton to set the restarts number.
   GtkLabel *label_mutation;     ///< GtkLabel to set the mutation ratio.
   GtkSpinButton *spin_mutation; ///< GtkSpinButton to set the mutation ratio.
   GtkLabel *label_reproduction; ///< GtkLabel to set the reproduction ratio.
@@ -66,6 +66,9 @@ OF SUCH DAMAGE.
 #include "experiment.h"
 #include "variable.h"
 #include "input.h"
+#include "template.h"
+#include "database.h"
+#include "best.h"
 #include "optimize.h"
 #if HAVE_GTK
 #include "interface.h"
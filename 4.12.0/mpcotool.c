@@ -64,6 +64,10 @@ OF SUCH DAMAGE.
 #include "experiment.h"
 #include "variable.h"
 #include "input.h"
+#include "template.h"
+#include "database.h"
+#include "best.h"
+#include "process.h"
 #include "optimize.h"
 #if HAVE_GTK
 #include "interface.h"
@@ -84,12 +88,21 @@ mpcotool (int argn,             ///< Arguments number.
   const struct option options[] = {
     {"seed", required_argument, NULL, 's'},
     {"nthreads", required_argument, NULL, 't'},
+#if !HAVE_MPI && !HAVE_GTK
+    {"nprocesses", required_argument, NULL, 'p'},
+#endif
     {NULL, 0, NULL, 0}
   };
+#if !HAVE_MPI && !HAVE_GTK
+  const char *short_options = "p:s:t:";
+  unsigned int nprocesses = 1;
+#else
+  const char *short_options = "s:t:";
+#endif
 #if HAVE_GTK
   GtkApplication *application;
 #endif
-  int o, option_index;
+  int o, option_index, code = 0;
 
   // Starting pseudo-random numbers generator
 #if DEBUG_MPCOTOOL
@@ -110,8 +123,8 @@ mpcotool (int argn,             ///< Arguments number.
 #endif
   MPI_Init (&argn, &argc);
   MPI_Comm_size (MPI_COMM_WORLD, &ntasks);
-  MPI_Comm_rank (MPI_COMM_WORLD, &optimize->mpi_rank);
-  printf ("rank=%d tasks=%d\n", optimize->mpi_rank, ntasks);
+  MPI_Comm_rank (MPI_COMM_WORLD, &optimize->rank);
+  printf ("rank=%d tasks=%d\n", optimize->rank, ntasks);
 #else
   ntasks = 1;
 #endif
@@ -123,7 +136,7 @@ mpcotool (int argn,             ///< Arguments number.
   // Parsing command line arguments
   while (1)
     {
-      o = getopt_long (argn, argc, "s:t:", options, &option_index);
+      o = getopt_long (argn, argc, short_options, options, &option_index);
       if (o == -1)
         break;
       switch (o)
@@ -134,6 +147,11 @@ mpcotool (int argn,             ///< Arguments number.
         case 't':
           nthreads_climbing = nthreads = atoi (optarg);
           break;
+#if !HAVE_MPI && !HAVE_GTK
+        case 'p':
+          nprocesses = atoi (optarg);
+          break;
+#endif
         default:
           printf ("%s\n%s\n", _("ERROR!"), _("Unknown option"));
           return 1;
@@ -173,9 +191,11 @@ mpcotool (int argn,             ///< Arguments number.
   // Checking syntax
   if (argn < 1 || argn > 3)
     {
-      printf ("The syntax is:\n"
-              "./mpcotoolbin [-nthreads x] [-seed s] data_file [result_file] "
-              "[variables_file]\n");
+      printf ("The syntax is:\n./mpcotoolbin [-nthreads x] [-seed s] ");
+#if !HAVE_MPI
+      printf ("[-nprocesses p] ");
+#endif
+      printf ("data_file [result_file] [variables_file]\n");
       return 2;
     }
   if (argn > 1)
@@ -187,14 +207,36 @@ mpcotool (int argn,             ///< Arguments number.
 #if DEBUG_MPCOTOOL
   fprintf (stderr, "mpcotool: making optimization\n");
 #endif
-  if (input_open (argc[optind]))
-    optimize_open ();
+  if (!input_open (argc[optind]))
+    code = 1;
+  else
+    {
+#if !HAVE_MPI
+      // Forking the local worker processes
+#if DEBUG_MPCOTOOL
+      fprintf (stderr, "mpcotool: forking %u processes\n", nprocesses);
+#endif
+      if (!process_open (nprocesses))
+        {
+          printf ("%s\n%s\n", _("ERROR!"),
+                  _("Unable to start the worker processes"));
+          code = 1;
+        }
+      ntasks = (int) process->nprocesses;
+      optimize->rank = process->rank;
+#endif
+      if (!code && !optimize_open ())
+        code = 1;
+    }
 
   // Freeing memory
 #if DEBUG_MPCOTOOL
   fprintf (stderr, "mpcotool: freeing memory and closing\n");
 #endif
   optimize_free ();
+#if !HAVE_MPI
+  process_close ();
+#endif
 
 #endif
 
@@ -207,5 +249,5 @@ mpcotool (int argn,             ///< Arguments number.
   gsl_rng_free (optimize->rng);
 
   // Closing
-  return 0;
+  return code;
 }
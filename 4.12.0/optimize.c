@@ -41,18 +41,32 @@ OF SUCH DAMAGE.
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <float.h>
 #include <sys/param.h>
 #include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_qrng.h>
 #include <libxml/parser.h>
 #include <libintl.h>
 #include <glib.h>
 #include <glib/gstdio.h>
+#include <gmodule.h>
 #include <json-glib/json-glib.h>
 #ifdef G_OS_WIN32
 #include <windows.h>
 #elif !defined(__BSD_VISIBLE) && !defined(NetBSD)
 #include <alloca.h>
 #endif
+#ifndef G_OS_WIN32
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
 #if HAVE_MPI
 #include <mpi.h>
 #endif
@@ -62,23 +76,18 @@ OF SUCH DAMAGE.
 #include "experiment.h"
 #include "variable.h"
 #include "input.h"
+#include "template.h"
+#include "database.h"
+#include "binary.h"
+#include "best.h"
+#include "process.h"
+#include "plugin.h"
 #include "optimize.h"
 
 #define DEBUG_OPTIMIZE 0        ///< Macro to debug optimize functions.
 
-/**
- * \def CP
- * \brief Macro to define the shell copy command.
- * \def RM
- * \brief Macro to define the shell remove command.
- */
-#ifdef G_OS_WIN32
-#define CP "copy"
-#define RM "del"
-#else
-#define CP "cp"
-#define RM "rm"
-#endif
+#define CACHE_KEY_LENGTH 32
+///< Length in bytes of the evaluation cache keys (SHA-256 digests).
 
 Optimize optimize[1];           ///< Optimization data.
 unsigned int nthreads_climbing;
@@ -86,96 +95,159 @@ unsigned int nthreads_climbing;
 
 static void (*optimize_algorithm) ();
 ///< Pointer to the function to perform a optimization algorithm step.
-static double (*optimize_estimate_climbing) (unsigned int variable,
+static void (*optimize_sample) (double *value);
+///< Pointer to the function to sample the simulations of a sampling algorithm.
+static void (*optimize_climbing_method) (unsigned int nsteps);
+///< Pointer to the function to optimize with a hill climbing method.
+static double (*optimize_estimate_climbing) (unsigned int climber,
+                                             unsigned int variable,
                                              unsigned int estimate);
 ///< Pointer to the function to estimate the climbing.
-static double (*optimize_norm) (unsigned int simulation);
-///< Pointer to the error norm function.
+static double (*optimize_norm) (double *error, unsigned int n);
+///< Pointer to the function to reduce the experiment errors to the error norm.
+static double (*optimize_objective) (unsigned int simulation,
+                                     unsigned int experiment);
+///< Pointer to the function to calculate the objective function value.
+static double (*optimize_simulate) (unsigned int simulation,
+                                    unsigned int experiment);
+///< Pointer to the function to calculate a not cached objective function value.
+static unsigned int optimize_cache_values;
+///< Variable values in the cache key: 0 none, 1 printed, 2 binary.
+static double (*optimize_database_simulate) (unsigned int simulation,
+                                             unsigned int experiment);
+///< Pointer to the function to calculate a not stored objective function value.
+static double optimize_variables_end[1];
+///< Mark to stop the variables file writer.
+static double optimize_variables_iteration[1];
+///< Mark to end an iteration in the variables file writer.
+static GModule *optimize_module = NULL; ///< Simulator plugin module.
+static PluginVariables optimize_plugin_variables;
+///< Pointer to the plugin function working with the variable values.
+static PluginInputs optimize_plugin_inputs;
+///< Pointer to the plugin function working with the input files contents.
+
+/**
+ * Function to get the contents of a simulation input file in memory, rendering
+ *   the precompiled template if needed.
+ *
+ * \return input file contents (valid in the calling thread until the next
+ *   render of the same input) or NULL on empty input.
+ */
+static inline const char *
+optimize_content (unsigned int simulation,      ///< Simulation number.
+                  unsigned int input,   ///< Input file number.
+                  unsigned int experiment,      ///< Experiment number.
+                  size_t *length)       ///< Pointer to the contents length.
+{
+  GMappedFile *stencil;
+  stencil = optimize->file[input][experiment];
+  if (!stencil)
+    {
+      *length = 0;
+      return NULL;
+    }
+  if (optimize->template_flags & (1u << input))
+    return template_render (optimize->template[input] + experiment, input,
+                            optimize->label,
+                            optimize->value
+                            + simulation * optimize->nvariables,
+                            optimize->precision, length);
+  *length = g_mapped_file_get_length (stencil);
+  return g_mapped_file_get_contents (stencil);
+}
 
 /**
  * Function to write the simulation input file.
+ *
+ * \return 1 on success, 0 on error.
  */
-static inline void
+static inline int
 optimize_input (unsigned int simulation,        ///< Simulation number.
-                char *input,    ///< Input file name.
-                GMappedFile * stencil)  ///< Template of the input file name.
+                char *name,     ///< Input file name.
+                unsigned int input,     ///< Input file number.
+                unsigned int experiment)        ///< Experiment number.
 {
-  char buffer[256], value[32];
-  GRegex *regex;
   FILE *file;
-  char *buffer2, *buffer3 = NULL, *content;
-  gsize length;
-  unsigned int i;
+  const char *buffer;
+  size_t length;
+  int ok = 1;
 
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_input: start\n");
 #endif
 
-  // Checking the file
-  if (!stencil)
+  // Rendering the template
+  buffer = optimize_content (simulation, input, experiment, &length);
+  if (!buffer)
     goto optimize_input_end;
 
-  // Opening stencil
-  content = g_mapped_file_get_contents (stencil);
-  length = g_mapped_file_get_length (stencil);
+  // Saving input file
+  file = g_fopen (name, "w");
+  if (!file || fwrite (buffer, sizeof (char), length, file) != length)
+    ok = 0;
+  if (file && fclose (file))
+    ok = 0;
+
+optimize_input_end:
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_input: length=%lu\ncontent:\n%s", length, content);
+  fprintf (stderr, "optimize_input: end\n");
 #endif
-  file = g_fopen (input, "w");
+  return ok;
+}
 
-  // Parsing stencil
-  for (i = 0; i < optimize->nvariables; ++i)
-    {
+/**
+ * Function to copy a non-template input file from its mapped contents.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static inline int
+optimize_copy (char *input,     ///< Input file name.
+               GMappedFile * stencil)   ///< Mapped original input file.
+{
+  FILE *file;
+  size_t length;
+  int ok = 1;
 #if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_input: variable=%u\n", i);
+  fprintf (stderr, "optimize_copy: start\n");
 #endif
-      snprintf (buffer, 32, "@variable%u@", i + 1);
-      regex = g_regex_new (buffer, (GRegexCompileFlags) 0, (GRegexMatchFlags) 0,
-                           NULL);
-      if (i == 0)
-        {
-          buffer2 = g_regex_replace_literal (regex, content, length, 0,
-                                             optimize->label[i],
-                                             (GRegexMatchFlags) 0, NULL);
+  if (!stencil)
+    goto optimize_copy_end;
+  length = g_mapped_file_get_length (stencil);
+  file = g_fopen (input, "wb");
+  if (!file || fwrite (g_mapped_file_get_contents (stencil), sizeof (char),
+                       length, file) != length)
+    ok = 0;
+  if (file && fclose (file))
+    ok = 0;
+optimize_copy_end:
 #if DEBUG_OPTIMIZE
-          fprintf (stderr, "optimize_input: buffer2\n%s", buffer2);
+  fprintf (stderr, "optimize_copy: end\n");
 #endif
-        }
-      else
-        {
-          length = strlen (buffer3);
-          buffer2 = g_regex_replace_literal (regex, buffer3, length, 0,
-                                             optimize->label[i],
-                                             (GRegexMatchFlags) 0, NULL);
-          g_free (buffer3);
-        }
-      g_regex_unref (regex);
-      length = strlen (buffer2);
-      snprintf (buffer, 32, "@value%u@", i + 1);
-      regex = g_regex_new (buffer, (GRegexCompileFlags) 0, (GRegexMatchFlags) 0,
-                           NULL);
-      snprintf (value, 32, format[optimize->precision[i]],
-                optimize->value[simulation * optimize->nvariables + i]);
+  return ok;
+}
 
-#if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_input: value=%s\n", value);
-#endif
-      buffer3 = g_regex_replace_literal (regex, buffer2, length, 0, value,
-                                         (GRegexMatchFlags) 0, NULL);
-      g_free (buffer2);
-      g_regex_unref (regex);
+/**
+ * Function to read the objective function value in a file.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static inline int
+optimize_read (char *name,      ///< File name.
+               double *e)       ///< Pointer to the objective function value.
+{
+  char buffer[512];
+  FILE *file;
+  int ok = 0;
+  file = g_fopen (name, "r");
+  if (!file)
+    return 0;
+  if (fgets (buffer, 512, file))
+    {
+      *e = atof (buffer);
+      ok = 1;
     }
-
-  // Saving input file
-  fwrite (buffer3, strlen (buffer3), sizeof (char), file);
-  g_free (buffer3);
   fclose (file);
-
-optimize_input_end:
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_input: end\n");
-#endif
-  return;
+  return ok;
 }
 
 /**
@@ -188,12 +260,12 @@ static double
 optimize_parse (unsigned int simulation,        ///< Simulation number.
                 unsigned int experiment)        ///< Experiment number.
 {
-  char buffer[512], cinput[MAX_NINPUTS][32], output[32], result[32], *buffer2,
-    *buffer3, *buffer4;
-  FILE *file_result;
+  char cinput[MAX_NINPUTS][32], output[32], result[32],
+    *argv[MAX_NINPUTS + 3];
   double e;
-  unsigned int i;
+  unsigned int i, n;
   unsigned int flags = 1;
+  int ok;
 
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_parse: start\n");
@@ -202,7 +274,11 @@ optimize_parse (unsigned int simulation,        ///< Simulation number.
 #endif
 
   // Opening input files
-  for (i = 0; i < optimize->ninputs; ++i)
+  e = INFINITY;
+  strcpy (result, "");
+  snprintf (output, 32, "output-%u-%u", simulation, experiment);
+  argv[0] = optimize->simulator;
+  for (i = n = 0; i < optimize->ninputs; n = ++i)
     {
       snprintf (&cinput[i][0], 32, "input-%u-%u-%u", i, simulation, experiment);
 #if DEBUG_OPTIMIZE
@@ -210,61 +286,55 @@ optimize_parse (unsigned int simulation,        ///< Simulation number.
 #endif
       // Checking simple copy
       if (optimize->template_flags & flags)
-        optimize_input (simulation, &cinput[i][0],
-                        optimize->file[i][experiment]);
+        ok = optimize_input (simulation, &cinput[i][0], i, experiment);
       else
+        ok = optimize_copy (&cinput[i][0], optimize->file[i][experiment]);
+      if (!ok)
         {
-          buffer2 = input->experiment[experiment].stencil[i];
-          snprintf (buffer, 512, CP " %s %s", buffer2, &cinput[i][0]);
-          if (system (buffer) == -1)
-            error_message = g_strdup (buffer);
+          fprintf (stderr, "%s: %s (%u-%u)\n", _("Unable to write the input"),
+                   &cinput[i][0], simulation, experiment);
+          n = i + 1;
+          goto optimize_parse_clean;
         }
+      argv[i + 1] = &cinput[i][0];
       flags <<= 1;
     }
-  for (; i < MAX_NINPUTS; ++i)
-    strcpy (&cinput[i][0], "");
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_parse: parsing end\n");
 #endif
 
   // Performing the simulation
-  snprintf (output, 32, "output-%u-%u", simulation, experiment);
-  buffer2 = g_path_get_dirname (optimize->simulator);
-  buffer3 = g_path_get_basename (optimize->simulator);
-  buffer4 = g_build_filename (buffer2, buffer3, NULL);
-  snprintf (buffer, 512, "\"%s\" %s %s %s %s %s %s %s %s %s",
-            buffer4, cinput[0], cinput[1], cinput[2], cinput[3], cinput[4],
-            cinput[5], cinput[6], cinput[7], output);
-  g_free (buffer4);
-  g_free (buffer3);
-  g_free (buffer2);
+  argv[i + 1] = output;
+  argv[i + 2] = NULL;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_parse: %s\n", buffer);
+  fprintf (stderr, "optimize_parse: simulator=%s\n", argv[0]);
 #endif
-  if (system (buffer) == -1)
-    error_message = g_strdup (buffer);
+  if (tools_spawn (argv))
+    {
+      fprintf (stderr, "%s: %s (%u-%u)\n", _("Simulation failed"),
+               optimize->simulator, simulation, experiment);
+      goto optimize_parse_clean;
+    }
 
   // Checking the objective value function
   if (optimize->evaluator)
     {
       snprintf (result, 32, "result-%u-%u", simulation, experiment);
-      buffer2 = g_path_get_dirname (optimize->evaluator);
-      buffer3 = g_path_get_basename (optimize->evaluator);
-      buffer4 = g_build_filename (buffer2, buffer3, NULL);
-      snprintf (buffer, 512, "\"%s\" %s %s %s",
-                buffer4, output, optimize->experiment[experiment], result);
-      g_free (buffer4);
-      g_free (buffer3);
-      g_free (buffer2);
-#if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_parse: %s\n", buffer);
+      argv[0] = optimize->evaluator;
+      argv[1] = output;
+      argv[2] = optimize->experiment[experiment];
+      argv[3] = result;
+      argv[4] = NULL;
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_parse: evaluator=%s\n", argv[0]);
       fprintf (stderr, "optimize_parse: result=%s\n", result);
 #endif
-      if (system (buffer) == -1)
-        error_message = g_strdup (buffer);
-      file_result = g_fopen (result, "r");
-      e = atof (fgets (buffer, 512, file_result));
-      fclose (file_result);
+      if (tools_spawn (argv) || !optimize_read (result, &e))
+        {
+          fprintf (stderr, "%s: %s (%u-%u)\n", _("Evaluation failed"),
+                   optimize->evaluator, simulation, experiment);
+          e = INFINITY;
+        }
     }
   else
     {
@@ -272,37 +342,30 @@ optimize_parse (unsigned int simulation,        ///< Simulation number.
       fprintf (stderr, "optimize_parse: output=%s\n", output);
 #endif
       strcpy (result, "");
-      file_result = g_fopen (output, "r");
-      e = atof (fgets (buffer, 512, file_result));
-      fclose (file_result);
+      if (!optimize_read (output, &e))
+        {
+          fprintf (stderr, "%s: %s (%u-%u)\n", _("Bad simulation output"),
+                   optimize->simulator, simulation, experiment);
+          e = INFINITY;
+        }
     }
 
   // Removing files
+optimize_parse_clean:
   if (optimize->cleaner)
     {
-      buffer2 = g_path_get_dirname (optimize->cleaner);
-      buffer3 = g_path_get_basename (optimize->cleaner);
-      buffer4 = g_build_filename (buffer2, buffer3, NULL);
-      snprintf (buffer, 512, "\"%s\"", buffer4);
-      g_free (buffer4);
-      g_free (buffer3);
-      g_free (buffer2);
-      if (system (buffer) == -1)
-        error_message = g_strdup (buffer);
+      argv[0] = optimize->cleaner;
+      argv[1] = NULL;
+      if (tools_spawn (argv))
+        fprintf (stderr, "%s: %s\n", _("Cleaning failed"), optimize->cleaner);
     }
 #if !DEBUG_OPTIMIZE
-  for (i = 0; i < optimize->ninputs; ++i)
-    {
-      if (optimize->file[i][0])
-        {
-          snprintf (buffer, 512, RM " %s", &cinput[i][0]);
-          if (system (buffer) == -1)
-            error_message = g_strdup (buffer);
-        }
-    }
-  snprintf (buffer, 512, RM " %s %s", output, result);
-  if (system (buffer) == -1)
-    error_message = g_strdup (buffer);
+  for (i = 0; i < n; ++i)
+    if (optimize->file[i][0])
+      g_unlink (&cinput[i][0]);
+  g_unlink (output);
+  if (result[0])
+    g_unlink (result);
 #endif
 
   // Processing pending events
@@ -314,398 +377,1774 @@ optimize_parse (unsigned int simulation,        ///< Simulation number.
 #endif
 
   // Returning the objective function
-  return e * optimize->weight[experiment];
+  return e;
 }
 
 /**
- * Function to calculate the Euclidian error norm.
+ * Function to calculate the objective function calling the simulator plugin
+ *   without creating processes nor files.
  *
- * \return Euclidian error norm.
+ * \return Objective function value.
  */
 static double
-optimize_norm_euclidian (unsigned int simulation)       ///< simulation number.
+optimize_plugin (unsigned int simulation,       ///< Simulation number.
+                 unsigned int experiment)       ///< Experiment number.
 {
-  double e, ei;
+  const char *input[MAX_NINPUTS];
+  size_t length[MAX_NINPUTS];
+  double e;
   unsigned int i;
+
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_norm_euclidian: start\n");
+  fprintf (stderr, "optimize_plugin: start\n");
+  fprintf (stderr, "optimize_plugin: simulation=%u experiment=%u\n",
+           simulation, experiment);
 #endif
-  e = 0.;
-  for (i = 0; i < optimize->nexperiments; ++i)
+
+  // Working directly with the variable values
+  if (optimize_plugin_variables)
     {
-      ei = optimize_parse (simulation, i);
-      e += ei * ei;
+      e = optimize_plugin_variables (optimize->value
+                                     + simulation * optimize->nvariables,
+                                     optimize->nvariables, experiment,
+                                     optimize->experiment[experiment]);
+      goto optimize_plugin_end;
     }
-  e = sqrt (e);
+
+  // Rendering the input files in memory
+  for (i = 0; i < optimize->ninputs; ++i)
+    input[i] = optimize_content (simulation, i, experiment, length + i);
+  e = optimize_plugin_inputs (input, length, optimize->ninputs, experiment,
+                              optimize->experiment[experiment]);
+
+optimize_plugin_end:
+  if (isnan (e))
+    e = INFINITY;
+
+  // Processing pending events
+  if (show_pending)
+    show_pending ();
+
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_norm_euclidian: error=%lg\n", e);
-  fprintf (stderr, "optimize_norm_euclidian: end\n");
+  fprintf (stderr, "optimize_plugin: e=%lg\n", e);
+  fprintf (stderr, "optimize_plugin: end\n");
 #endif
+
+  // Returning the objective function
   return e;
 }
 
 /**
- * Function to calculate the maximum error norm.
+ * Function to launch a persistent simulator process.
  *
- * \return Maximum error norm.
+ * \return 1 on success, 0 on error.
  */
-static double
-optimize_norm_maximum (unsigned int simulation) ///< simulation number.
+static int
+optimize_server_open (Server * server)  ///< Server struct.
 {
-  double e, ei;
-  unsigned int i;
+  char *argv[2];
+  int fd_in, fd_out;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_norm_maximum: start\n");
+  fprintf (stderr, "optimize_server_open: start\n");
 #endif
-  e = 0.;
-  for (i = 0; i < optimize->nexperiments; ++i)
-    {
-      ei = fabs (optimize_parse (simulation, i));
-      e = fmax (e, ei);
-    }
+  server->request = server->reply = NULL;
+  argv[0] = optimize->simulator;
+  argv[1] = NULL;
+  if (!tools_spawn_pipes (argv, &server->pid, &fd_in, &fd_out))
+    return 0;
+  server->request = fdopen (fd_in, "wb");
+  server->reply = fdopen (fd_out, "rb");
+  setvbuf (server->reply, NULL, _IONBF, 0);
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_norm_maximum: error=%lg\n", e);
-  fprintf (stderr, "optimize_norm_maximum: end\n");
+  fprintf (stderr, "optimize_server_open: end\n");
 #endif
-  return e;
+  return 1;
 }
 
 /**
- * Function to calculate the P error norm.
- *
- * \return P error norm.
+ * Function to finish a persistent simulator process.
  */
-static double
-optimize_norm_p (unsigned int simulation)       ///< simulation number.
+static void
+optimize_server_close (Server * server) ///< Server struct.
 {
-  double e, ei;
-  unsigned int i;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_norm_p: start\n");
+  fprintf (stderr, "optimize_server_close: start\n");
 #endif
-  e = 0.;
-  for (i = 0; i < optimize->nexperiments; ++i)
-    {
-      ei = fabs (optimize_parse (simulation, i));
-      e += pow (ei, optimize->p);
-    }
-  e = pow (e, 1. / optimize->p);
+  if (!server->request)
+    return;
+  fclose (server->request);
+  fclose (server->reply);
+  server->request = server->reply = NULL;
+  if (server->pid)
+    tools_kill (server->pid);
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_norm_p: error=%lg\n", e);
-  fprintf (stderr, "optimize_norm_p: end\n");
+  fprintf (stderr, "optimize_server_close: end\n");
 #endif
-  return e;
 }
 
 /**
- * Function to calculate the taxicab error norm.
+ * Function to receive a reply line from a persistent simulator process,
+ *   waiting at most input->timeout seconds.
  *
- * \return Taxicab error norm.
+ * The reply stream is unbuffered, so that no received data can be pending
+ * on the stream while polling its file descriptor.
+ *
+ * \return 1 on success, 0 on error or timeout.
  */
-static double
-optimize_norm_taxicab (unsigned int simulation) ///< simulation number.
+static int
+optimize_server_receive (Server * server,       ///< Server struct.
+                         char *buffer,  ///< Reply buffer.
+                         unsigned int n)        ///< Reply buffer size.
 {
-  double e;
-  unsigned int i;
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_norm_taxicab: start\n");
-#endif
-  e = 0.;
-  for (i = 0; i < optimize->nexperiments; ++i)
-    e += fabs (optimize_parse (simulation, i));
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_norm_taxicab: error=%lg\n", e);
-  fprintf (stderr, "optimize_norm_taxicab: end\n");
+#ifndef G_OS_WIN32
+  struct pollfd pfd[1];
+  gint64 t = 0;
+  int ms = -1;
 #endif
-  return e;
-}
-
-/**
- * Function to print the results.
- */
-static void
-optimize_print ()
-{
   unsigned int i;
-  char buffer[512];
-#if HAVE_MPI
-  if (optimize->mpi_rank)
-    return;
+  int c;
+#ifndef G_OS_WIN32
+  pfd->fd = fileno (server->reply);
+  pfd->events = POLLIN;
+  if (input->timeout)
+    t = g_get_monotonic_time () + (gint64) input->timeout * G_USEC_PER_SEC;
 #endif
-  printf ("%s\n", _("Best result"));
-  fprintf (optimize->file_result, "%s\n", _("Best result"));
-  printf ("error = %.15le\n", optimize->error_old[0]);
-  fprintf (optimize->file_result, "error = %.15le\n", optimize->error_old[0]);
-  for (i = 0; i < optimize->nvariables; ++i)
+  for (i = 0; i < n - 1;)
     {
-      snprintf (buffer, 512, "%s = %s\n",
-                optimize->label[i], format[optimize->precision[i]]);
-      printf (buffer, optimize->value_old[i]);
-      fprintf (optimize->file_result, buffer, optimize->value_old[i]);
+#ifndef G_OS_WIN32
+      if (input->timeout)
+        {
+          ms = (int) ((t - g_get_monotonic_time ()) / 1000);
+          if (ms <= 0)
+            return 0;
+        }
+      c = poll (pfd, 1, ms);
+      if (c < 0 && errno == EINTR)
+        continue;
+      if (c <= 0)
+        return 0;
+#endif
+      c = getc (server->reply);
+      if (c == EOF)
+        return 0;
+      buffer[i++] = (char) c;
+      if (c == '\n')
+        break;
     }
-  fflush (optimize->file_result);
+  buffer[i] = 0;
+  return 1;
 }
 
 /**
- * Function to save in a file the variables and the error.
+ * Function to send a simulation to a persistent simulator process and to
+ *   receive the objective function value.
+ *
+ * The request is formed by the line "experiment ninputs nvariables", the line
+ * with the experimental data file name, a line for every variable value and,
+ * for every input file, a line with its length in bytes followed by its
+ * contents. The reply is a line with the objective function value.
+ *
+ * \return 1 on success, 0 on error.
  */
-static void
-optimize_save_variables (unsigned int simulation,       ///< Simulation number.
-                         double error)  ///< Error value.
+static int
+optimize_server_run (Server * server,   ///< Server struct.
+                     unsigned int simulation,   ///< Simulation number.
+                     unsigned int experiment,   ///< Experiment number.
+                     double *e) ///< Pointer to the objective function value.
 {
+  char buffer[512], *end;
+  const char *content;
+  size_t length;
   unsigned int i;
-  char buffer[64];
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_save_variables: start\n");
-#endif
+  int ok = 0;
+
+  // Checking a crashed process not respawned
+  if (!server->request)
+    return 0;
+
+  // Sending the variable values
+  fprintf (server->request, "%u %u %u\n%s\n", experiment, optimize->ninputs,
+           optimize->nvariables, optimize->experiment[experiment]);
   for (i = 0; i < optimize->nvariables; ++i)
     {
-      snprintf (buffer, 64, "%s ", format[optimize->precision[i]]);
-      fprintf (optimize->file_variables, buffer,
+      fprintf (server->request, format[optimize->precision[i]],
                optimize->value[simulation * optimize->nvariables + i]);
+      putc ('\n', server->request);
     }
-  fprintf (optimize->file_variables, "%.14le\n", error);
-  fflush (optimize->file_variables);
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_save_variables: end\n");
-#endif
+
+  // Sending the input files
+  for (i = 0; i < optimize->ninputs; ++i)
+    {
+      content = optimize_content (simulation, i, experiment, &length);
+      fprintf (server->request, "%lu\n", (unsigned long int) length);
+      if (length)
+        fwrite (content, sizeof (char), length, server->request);
+    }
+  if (fflush (server->request))
+    goto optimize_server_run_end;
+
+  // Receiving the objective function value
+  if (!optimize_server_receive (server, buffer, 512))
+    goto optimize_server_run_end;
+  *e = strtod (buffer, &end);
+  ok = (end != buffer);
+
+optimize_server_run_end:
+  return ok;
 }
 
 /**
- * Function to save the best simulations.
+ * Function to calculate the objective function with a persistent simulator
+ *   process, respawning it if it has crashed.
+ *
+ * \return Objective function value.
  */
-static void
-optimize_best (unsigned int simulation, ///< Simulation number.
-               double value)    ///< Objective function value.
+static double
+optimize_server (unsigned int simulation,       ///< Simulation number.
+                 unsigned int experiment)       ///< Experiment number.
 {
-  unsigned int i, j;
+  Server *server;
   double e;
+
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_best: start\n");
-  fprintf (stderr, "optimize_best: nsaveds=%u nbest=%u\n",
-           optimize->nsaveds, optimize->nbest);
+  fprintf (stderr, "optimize_server: start\n");
+  fprintf (stderr, "optimize_server: simulation=%u experiment=%u\n",
+           simulation, experiment);
 #endif
-  if (optimize->nsaveds < optimize->nbest
-      || value < optimize->error_best[optimize->nsaveds - 1])
+
+  // Getting an idle simulator process
+  server = (Server *) g_async_queue_pop (optimize->queue_server);
+
+  // Performing the simulation
+  if (!optimize_server_run (server, simulation, experiment, &e))
     {
-      if (optimize->nsaveds < optimize->nbest)
-        ++optimize->nsaveds;
-      optimize->error_best[optimize->nsaveds - 1] = value;
-      optimize->simulation_best[optimize->nsaveds - 1] = simulation;
-      for (i = optimize->nsaveds; --i;)
+      // Respawning the crashed process and retrying once
+      fprintf (stderr, "%s: %s (%u-%u)\n", _("Simulator server failed"),
+               optimize->simulator, simulation, experiment);
+      optimize_server_close (server);
+      if (!optimize_server_open (server)
+          || !optimize_server_run (server, simulation, experiment, &e))
         {
-          if (optimize->error_best[i] < optimize->error_best[i - 1])
-            {
-              j = optimize->simulation_best[i];
-              e = optimize->error_best[i];
-              optimize->simulation_best[i] = optimize->simulation_best[i - 1];
-              optimize->error_best[i] = optimize->error_best[i - 1];
-              optimize->simulation_best[i - 1] = j;
-              optimize->error_best[i - 1] = e;
-            }
-          else
-            break;
+          fprintf (stderr, "%s: %s (%u-%u)\n", _("Simulation failed"),
+                   optimize->simulator, simulation, experiment);
+          optimize_server_close (server);
+          optimize_server_open (server);
+          e = INFINITY;
         }
     }
+  if (isnan (e))
+    e = INFINITY;
+
+  // Releasing the simulator process
+  g_async_queue_push (optimize->queue_server, server);
+
+  // Processing pending events
+  if (show_pending)
+    show_pending ();
+
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_best: end\n");
+  fprintf (stderr, "optimize_server: e=%lg\n", e);
+  fprintf (stderr, "optimize_server: end\n");
 #endif
+
+  // Returning the objective function
+  return e;
 }
 
 /**
- * Function to optimize sequentially.
+ * Function to calculate the objective function on the first idle slot of the
+ *   worker daemons, so that every daemon pulls simulations at the rate of its
+ *   own throughput. A lost slot is discarded and the simulation is retried on
+ *   another one.
+ *
+ * \return Objective function value.
  */
-static void
-optimize_sequential ()
+static double
+optimize_remote (unsigned int simulation,       ///< Simulation number.
+                 unsigned int experiment)       ///< Experiment number.
 {
-  unsigned int i;
+  Server *server;
   double e;
+
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_sequential: start\n");
-  fprintf (stderr, "optimize_sequential: nstart=%u nend=%u\n",
-           optimize->nstart, optimize->nend);
+  fprintf (stderr, "optimize_remote: start\n");
+  fprintf (stderr, "optimize_remote: simulation=%u experiment=%u\n",
+           simulation, experiment);
 #endif
-  for (i = optimize->nstart; i < optimize->nend; ++i)
+
+  // Getting an idle worker slot
+  server = (Server *) g_async_queue_pop (optimize->queue_server);
+
+  // Performing the simulation
+  while (!optimize_server_run (server, simulation, experiment, &e))
     {
-      e = optimize_norm (i);
-      optimize_best (i, e);
-      optimize_save_variables (i, e);
-      if (e < optimize->threshold)
+      e = INFINITY;
+
+      // Checking the closed slot left in the queue when all the slots are lost
+      if (!server->request)
+        break;
+
+      // Discarding the lost slot
+      fprintf (stderr, "%s (%u-%u)\n", _("Worker slot lost"), simulation,
+               experiment);
+      optimize_server_close (server);
+      if (g_atomic_int_dec_and_test (&optimize->nremotes))
         {
+          fprintf (stderr, "%s\n", _("All the worker slots lost"));
           optimize->stop = 1;
           break;
         }
-#if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_sequential: i=%u e=%lg\n", i, e);
-#endif
+      server = (Server *) g_async_queue_pop (optimize->queue_server);
     }
+  if (isnan (e))
+    e = INFINITY;
+
+  // Releasing the worker slot
+  g_async_queue_push (optimize->queue_server, server);
+
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_sequential: end\n");
+  fprintf (stderr, "optimize_remote: e=%lg\n", e);
+  fprintf (stderr, "optimize_remote: end\n");
 #endif
+
+  // Returning the objective function
+  return e;
 }
 
 /**
- * Function to optimize on a thread.
+ * Function to get the hash of a evaluation cache key.
  *
- * \return NULL.
+ * \return hash value.
  */
-static void *
-optimize_thread (ParallelData * data)   ///< Function data.
+static guint
+optimize_cache_hash (gconstpointer key) ///< Simulation digest.
 {
-  unsigned int i, thread;
-  double e;
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_thread: start\n");
-#endif
-  thread = data->thread;
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_thread: thread=%u start=%u end=%u\n", thread,
-           optimize->thread[thread], optimize->thread[thread + 1]);
-#endif
-  for (i = optimize->thread[thread]; i < optimize->thread[thread + 1]; ++i)
-    {
-      e = optimize_norm (i);
-      g_mutex_lock (mutex);
-      optimize_best (i, e);
-      optimize_save_variables (i, e);
-      if (e < optimize->threshold)
-        optimize->stop = 1;
-      g_mutex_unlock (mutex);
-      if (optimize->stop)
-        break;
-#if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_thread: i=%u e=%lg\n", i, e);
-#endif
-    }
-#if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_thread: end\n");
-#endif
-  g_thread_exit (NULL);
-  return NULL;
+  guint hash;
+  memcpy (&hash, key, sizeof (guint));
+  return hash;
+}
+
+/**
+ * Function to compare two evaluation cache keys.
+ *
+ * \return TRUE on equal keys, FALSE otherwise.
+ */
+static gboolean
+optimize_cache_equal (gconstpointer key1,       ///< 1st simulation digest.
+                      gconstpointer key2)       ///< 2nd simulation digest.
+{
+  return !memcmp (key1, key2, CACHE_KEY_LENGTH);
+}
+
+/**
+ * Function to calculate the evaluation cache key of a simulation: the SHA-256
+ *   digest of the experiment number and the rendered input files, adding the
+ *   variable values if they are passed directly to the simulator.
+ */
+static void
+optimize_cache_key (unsigned int simulation,    ///< Simulation number.
+                    unsigned int experiment,    ///< Experiment number.
+                    guint8 * key)       ///< Simulation digest.
+{
+  char buffer[32];
+  GChecksum *checksum;
+  const char *content;
+  double *value;
+  size_t length;
+  gsize size = CACHE_KEY_LENGTH;
+  unsigned int i;
+  checksum = g_checksum_new (G_CHECKSUM_SHA256);
+  g_checksum_update (checksum, (const guchar *) &experiment,
+                     sizeof (unsigned int));
+  for (i = 0; i < optimize->ninputs; ++i)
+    if (optimize->template_flags & (1u << i))
+      {
+        content = optimize_content (simulation, i, experiment, &length);
+        g_checksum_update (checksum, (const guchar *) &length,
+                           sizeof (size_t));
+        if (length)
+          g_checksum_update (checksum, (const guchar *) content, length);
+      }
+  value = optimize->value + simulation * optimize->nvariables;
+  switch (optimize_cache_values)
+    {
+    case 1:
+      for (i = 0; i < optimize->nvariables; ++i)
+        {
+          snprintf (buffer, 32, format[optimize->precision[i]], value[i]);
+          g_checksum_update (checksum, (const guchar *) buffer,
+                             strlen (buffer) + 1);
+        }
+      break;
+    case 2:
+      g_checksum_update (checksum, (const guchar *) value,
+                         optimize->nvariables * sizeof (double));
+    }
+  g_checksum_get_digest (checksum, key, &size);
+  g_checksum_free (checksum);
+}
+
+/**
+ * Function to calculate the objective function looking first in the
+ *   evaluation cache.
+ *
+ * \return Objective function value.
+ */
+static double
+optimize_cached (unsigned int simulation,       ///< Simulation number.
+                 unsigned int experiment)       ///< Experiment number.
+{
+  guint8 key[CACHE_KEY_LENGTH];
+  Cache *cache;
+  double *value;
+  double e;
+
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_cached: start\n");
+#endif
+
+  // Looking for the simulation
+  optimize_cache_key (simulation, experiment, key);
+  cache = optimize->cache + key[sizeof (guint)] % NCACHES;
+  g_mutex_lock (cache->mutex);
+  value = (double *) g_hash_table_lookup (cache->table, key);
+  if (value)
+    e = *value;
+  g_mutex_unlock (cache->mutex);
+  if (value)
+    {
+      g_atomic_int_inc (&optimize->cache_hits);
+      goto optimize_cached_end;
+    }
+
+  // Performing the simulation and saving the objective function value
+  g_atomic_int_inc (&optimize->cache_misses);
+  e = optimize_simulate (simulation, experiment);
+  if (isfinite (e))
+    {
+      g_mutex_lock (cache->mutex);
+      g_hash_table_insert (cache->table, g_memdup2 (key, CACHE_KEY_LENGTH),
+                           g_memdup2 (&e, sizeof (double)));
+      g_mutex_unlock (cache->mutex);
+    }
+
+optimize_cached_end:
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_cached: e=%lg\n", e);
+  fprintf (stderr, "optimize_cached: end\n");
+#endif
+  return e;
+}
+
+/**
+ * Function to calculate the database key of a simulation: the SHA-256 digest
+ *   of the variable names and values, printed with their precision, and the
+ *   experimental data file name.
+ */
+static void
+optimize_database_key (unsigned int simulation, ///< Simulation number.
+                       unsigned int experiment, ///< Experiment number.
+                       guint8 * key)    ///< Simulation digest.
+{
+  char buffer[32];
+  GChecksum *checksum;
+  double *value;
+  gsize size = DATABASE_KEY_LENGTH;
+  unsigned int i;
+  checksum = g_checksum_new (G_CHECKSUM_SHA256);
+  value = optimize->value + simulation * optimize->nvariables;
+  for (i = 0; i < optimize->nvariables; ++i)
+    {
+      g_checksum_update (checksum, (const guchar *) optimize->label[i],
+                         strlen (optimize->label[i]) + 1);
+      snprintf (buffer, 32, format[optimize->precision[i]], value[i]);
+      g_checksum_update (checksum, (const guchar *) buffer,
+                         strlen (buffer) + 1);
+    }
+  g_checksum_update (checksum,
+                     (const guchar *) optimize->experiment[experiment],
+                     strlen (optimize->experiment[experiment]) + 1);
+  g_checksum_get_digest (checksum, key, &size);
+  g_checksum_free (checksum);
+}
+
+/**
+ * Function to calculate the objective function looking first in the
+ *   persistent evaluation database and saving new values on it.
+ *
+ * \return Objective function value.
+ */
+static double
+optimize_stored (unsigned int simulation,       ///< Simulation number.
+                 unsigned int experiment)       ///< Experiment number.
+{
+  guint8 key[DATABASE_KEY_LENGTH];
+  double e;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_stored: start\n");
+#endif
+  optimize_database_key (simulation, experiment, key);
+  if (!database_lookup (optimize->database, key, &e))
+    {
+      e = optimize_database_simulate (simulation, experiment);
+      database_append (optimize->database, key, e);
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_stored: e=%lg\n", e);
+  fprintf (stderr, "optimize_stored: end\n");
+#endif
+  return e;
+}
+
+/**
+ * Function to calculate the weighted objective function value of an
+ *   experiment.
+ *
+ * \return Weighted objective function value.
+ */
+static inline double
+optimize_weighted (unsigned int simulation,     ///< Simulation number.
+                   unsigned int experiment)     ///< Experiment number.
+{
+  return optimize_objective (simulation, experiment)
+    * optimize->weight[experiment];
+}
+
+/**
+ * Function to calculate the Euclidian error norm.
+ *
+ * \return Euclidian error norm.
+ */
+static double
+optimize_norm_euclidian (double *error, ///< Array of experiment errors.
+                         unsigned int n)        ///< Number of experiments.
+{
+  double e;
+  unsigned int i;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_norm_euclidian: start\n");
+#endif
+  e = 0.;
+  for (i = 0; i < n; ++i)
+    e += error[i] * error[i];
+  e = sqrt (e);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_norm_euclidian: error=%lg\n", e);
+  fprintf (stderr, "optimize_norm_euclidian: end\n");
+#endif
+  return e;
+}
+
+/**
+ * Function to calculate the maximum error norm.
+ *
+ * \return Maximum error norm.
+ */
+static double
+optimize_norm_maximum (double *error,   ///< Array of experiment errors.
+                       unsigned int n)  ///< Number of experiments.
+{
+  double e;
+  unsigned int i;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_norm_maximum: start\n");
+#endif
+  e = 0.;
+  for (i = 0; i < n; ++i)
+    e = fmax (e, fabs (error[i]));
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_norm_maximum: error=%lg\n", e);
+  fprintf (stderr, "optimize_norm_maximum: end\n");
+#endif
+  return e;
+}
+
+/**
+ * Function to calculate the P error norm.
+ *
+ * \return P error norm.
+ */
+static double
+optimize_norm_p (double *error, ///< Array of experiment errors.
+                 unsigned int n)        ///< Number of experiments.
+{
+  double e;
+  unsigned int i;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_norm_p: start\n");
+#endif
+  e = 0.;
+  for (i = 0; i < n; ++i)
+    e += pow (fabs (error[i]), optimize->p);
+  e = pow (e, 1. / optimize->p);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_norm_p: error=%lg\n", e);
+  fprintf (stderr, "optimize_norm_p: end\n");
+#endif
+  return e;
+}
+
+/**
+ * Function to calculate the taxicab error norm.
+ *
+ * \return Taxicab error norm.
+ */
+static double
+optimize_norm_taxicab (double *error,   ///< Array of experiment errors.
+                       unsigned int n)  ///< Number of experiments.
+{
+  double e;
+  unsigned int i;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_norm_taxicab: start\n");
+#endif
+  e = 0.;
+  for (i = 0; i < n; ++i)
+    e += fabs (error[i]);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_norm_taxicab: error=%lg\n", e);
+  fprintf (stderr, "optimize_norm_taxicab: end\n");
+#endif
+  return e;
+}
+
+/**
+ * Function to print the results.
+ */
+static void
+optimize_print ()
+{
+  unsigned int i;
+  char buffer[512];
+  if (optimize->rank)
+    return;
+  printf ("%s\n", _("Best result"));
+  fprintf (optimize->file_result, "%s\n", _("Best result"));
+  printf ("error = %.15le\n", optimize->error_old[0]);
+  fprintf (optimize->file_result, "error = %.15le\n", optimize->error_old[0]);
+  for (i = 0; i < optimize->nvariables; ++i)
+    {
+      snprintf (buffer, 512, "%s = %s\n",
+                optimize->label[i], format[optimize->precision[i]]);
+      printf (buffer, optimize->value_old[i]);
+      fprintf (optimize->file_result, buffer, optimize->value_old[i]);
+    }
+  fflush (optimize->file_result);
+}
+
+/**
+ * Function to write the buffered rows in the variables file. The file is not
+ * buffered, so the rows are written complete with a single call.
+ */
+static void
+optimize_variables_write (GString * rows,       ///< Formatted text rows.
+                          double *block,
+                          ///< Block of columns of the binary format or NULL.
+                          unsigned int *nrows,
+                          ///< Pointer to the number of buffered rows.
+                          unsigned int maxrows,
+                          ///< Maximum number of rows of the block.
+                          unsigned int iteration)       ///< Iteration number.
+{
+  unsigned int i;
+  if (block)
+    {
+      if (!*nrows)
+        return;
+      for (i = 1; i <= optimize->nvariables; ++i)
+        memmove (block + 1 + i * *nrows, block + 1 + i * maxrows,
+                 *nrows * sizeof (double));
+      binary_write_block (optimize->file_variables, block, iteration, *nrows,
+                          optimize->nvariables + 1);
+    }
+  else if (rows->len)
+    {
+      fwrite (rows->str, 1, rows->len, optimize->file_variables);
+      g_string_truncate (rows, 0);
+    }
+  *nrows = 0;
+}
+
+/**
+ * Function to write the variables file on a thread, formatting the queued
+ * rows in batches, as text or as blocks of columns of the binary format.
+ *
+ * \return NULL.
+ */
+static void *
+optimize_variables_thread (gpointer data __attribute__((unused)))
+  ///< Unused thread data.
+{
+  GString *rows = NULL;
+  double *block = NULL, *row;
+  gint64 t;
+  unsigned int i, nrows, maxrows, iteration;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_variables_thread: start\n");
+#endif
+  maxrows = JBM_MAX (VARIABLES_BUFFER_SIZE
+                     / ((optimize->nvariables + 1) * sizeof (double)), 1);
+  if (optimize->binary)
+    block = (double *) g_malloc ((1 + (optimize->nvariables + 1) * maxrows)
+                                 * sizeof (double));
+  else
+    rows = g_string_sized_new (VARIABLES_BUFFER_SIZE);
+  nrows = iteration = 0;
+  t = g_get_monotonic_time ();
+  for (;;)
+    {
+      row = (double *) g_async_queue_timeout_pop (optimize->queue_variables,
+                                                  DEFAULT_VARIABLES_FLUSH);
+      if (row == optimize_variables_end)
+        break;
+      if (row == optimize_variables_iteration)
+        {
+          optimize_variables_write (rows, block, &nrows, maxrows, iteration);
+          ++iteration;
+          t = g_get_monotonic_time ();
+          continue;
+        }
+      if (row)
+        {
+          if (block)
+            for (i = 0; i <= optimize->nvariables; ++i)
+              block[1 + i * maxrows + nrows] = row[i];
+          else
+            {
+              for (i = 0; i < optimize->nvariables; ++i)
+                {
+                  g_string_append_printf (rows,
+                                          format[optimize->precision[i]],
+                                          row[i]);
+                  g_string_append_c (rows, ' ');
+                }
+              g_string_append_printf (rows, "%.14le\n", row[i]);
+            }
+          ++nrows;
+          g_free (row);
+          if ((block ? nrows < maxrows : rows->len < VARIABLES_BUFFER_SIZE)
+              && g_get_monotonic_time () - t < DEFAULT_VARIABLES_FLUSH)
+            continue;
+        }
+      optimize_variables_write (rows, block, &nrows, maxrows, iteration);
+      t = g_get_monotonic_time ();
+    }
+  optimize_variables_write (rows, block, &nrows, maxrows, iteration);
+  g_free (block);
+  if (rows)
+    g_string_free (rows, TRUE);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_variables_thread: end\n");
+#endif
+  return NULL;
+}
+
+/**
+ * Function to save in a file the variables and the error. The row is queued
+ * to the writer thread.
+ */
+static void
+optimize_save_variables (unsigned int simulation,       ///< Simulation number.
+                         double error)  ///< Error value.
+{
+  double *row;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_save_variables: start\n");
+#endif
+  row = (double *) g_malloc ((optimize->nvariables + 1) * sizeof (double));
+  memcpy (row, optimize->value + simulation * optimize->nvariables,
+          optimize->nvariables * sizeof (double));
+  row[optimize->nvariables] = error;
+  g_async_queue_push (optimize->queue_variables, row);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_save_variables: end\n");
+#endif
+}
+
+/**
+ * Function to place a simulation in a heap of the best simulations, going
+ * down from a position.
+ */
+static inline void
+optimize_heap_down (unsigned int *simulation_best,
+                    ///< Heap of best simulation numbers.
+                    double *error_best, ///< Heap of best errors.
+                    unsigned int n,     ///< Heap size.
+                    unsigned int i,     ///< Position.
+                    unsigned int simulation,    ///< Simulation number.
+                    double value)       ///< Objective function value.
+{
+  unsigned int j;
+  for (j = 2 * i + 1; j < n; i = j, j = 2 * i + 1)
+    {
+      if (j + 1 < n && error_best[j + 1] > error_best[j])
+        ++j;
+      if (error_best[j] <= value)
+        break;
+      simulation_best[i] = simulation_best[j];
+      error_best[i] = error_best[j];
+    }
+  simulation_best[i] = simulation;
+  error_best[i] = value;
+}
+
+/**
+ * Function to save the best simulations of a thread in a bounded heap with
+ * the worst saved simulation on the top.
+ */
+static inline void
+optimize_best (ParallelData * data,     ///< Thread data.
+               unsigned int simulation, ///< Simulation number.
+               double value)    ///< Objective function value.
+{
+  unsigned int i, j;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_best: start\n");
+  fprintf (stderr, "optimize_best: nsaveds=%u nbest=%u\n",
+           data->nsaveds, data->nbest);
+#endif
+  if (data->nsaveds < data->nbest)
+    {
+      for (i = data->nsaveds++; i; i = j)
+        {
+          j = (i - 1) / 2;
+          if (data->error_best[j] >= value)
+            break;
+          data->simulation_best[i] = data->simulation_best[j];
+          data->error_best[i] = data->error_best[j];
+        }
+      data->simulation_best[i] = simulation;
+      data->error_best[i] = value;
+    }
+  else if (value < data->error_best[0])
+    optimize_heap_down (data->simulation_best, data->error_best,
+                        data->nsaveds, 0, simulation, value);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_best: end\n");
+#endif
+}
+
+/**
+ * Function to sort the heap of the best simulations of a thread in
+ * increasing order of the objective function value.
+ */
+static inline void
+optimize_best_sort (ParallelData * data)        ///< Thread data.
+{
+  unsigned int i, s;
+  double e;
+  for (i = data->nsaveds; i-- > 1;)
+    {
+      s = data->simulation_best[i];
+      e = data->error_best[i];
+      data->simulation_best[i] = data->simulation_best[0];
+      data->error_best[i] = data->error_best[0];
+      optimize_heap_down (data->simulation_best, data->error_best, i, 0, s, e);
+    }
+}
+
+/**
+ * Function to save the best simulation in a hill climbing method. Every
+ *   climber keeps its best simulation in its own entry of the best simulations
+ *   array.
+ */
+static void
+optimize_best_climbing (unsigned int simulation,        ///< Simulation number.
+                        double value)   ///< Objective function value.
+{
+  unsigned int c;
+  c = (simulation - optimize->simulation_climbing) / optimize->nestimates;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_best_climbing: start\n");
+  fprintf (stderr,
+           "optimize_best_climbing: simulation=%u climber=%u value=%.14le "
+           "best=%.14le\n", simulation, c, value, optimize->error_best[c]);
+#endif
+  if (value < optimize->error_best[c])
+    {
+      optimize->error_best[c] = value;
+      optimize->simulation_best[c] = simulation;
+#if DEBUG_OPTIMIZE
+      fprintf (stderr,
+               "optimize_best_climbing: BEST simulation=%u value=%.14le\n",
+               simulation, value);
+#endif
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_best_climbing: end\n");
+#endif
+}
+
+/**
+ * Function to get the next task, an experiment of a simulation, to calculate
+ *   on a parallel pass.
+ *
+ * \return 1 on a task to calculate, 0 on the end of the pass.
+ */
+static inline int
+optimize_next (ParallelData * data,     ///< Thread data.
+               unsigned int *task)      ///< Task number.
+{
+  if (optimize->stop)
+    return 0;
+  *task = (unsigned int)
+    g_atomic_int_add ((gint *) optimize->nnext + data->pass, 1);
+  return *task < optimize->nlast[data->pass];
+}
+
+/**
+ * Function to calculate an experiment of a simulation on a thread, updating the
+ *   thread statistics of the experiment.
+ *
+ * \return weighted objective function value.
+ */
+static double
+optimize_experiment (ParallelData * data,       ///< Thread data.
+                     unsigned int simulation,   ///< Simulation number.
+                     unsigned int experiment)   ///< Experiment number.
+{
+  gint64 t;
+  double e;
+  unsigned int k;
+  t = g_get_monotonic_time ();
+  e = optimize_weighted (simulation, experiment);
+  t = g_get_monotonic_time () - t;
+  data->busy += t;
+  k = data->thread * optimize->nexperiments + experiment;
+  ++optimize->experiment_calculations[k];
+  optimize->experiment_time[k] += 0.000001 * t;
+  if (isfinite (e))
+    {
+      ++optimize->experiment_count[k];
+      optimize->experiment_sum[k] += e;
+      optimize->experiment_sum2[k] += e * e;
+    }
+  return e;
+}
+
+/**
+ * Function to calculate the statistics of an experiment of all the threads.
+ *
+ * \return number of finite objective function values of the experiment.
+ */
+static unsigned int
+optimize_experiment_statistics (unsigned int experiment,
+                                ///< Experiment number.
+                                double *time_mean,
+                                ///< Pointer to the mean calculation time.
+                                double *mean,
+                                ///< Pointer to the mean objective value.
+                                double *deviation)
+  ///< Pointer to the standard deviation of the objective function values.
+{
+  double n, s, s2;
+  unsigned int i, k, ne, nt;
+  *time_mean = s = s2 = 0.;
+  ne = nt = 0;
+  for (i = 0; i < optimize->nslots; ++i)
+    {
+      k = i * optimize->nexperiments + experiment;
+      nt += optimize->experiment_calculations[k];
+      *time_mean += optimize->experiment_time[k];
+      ne += optimize->experiment_count[k];
+      s += optimize->experiment_sum[k];
+      s2 += optimize->experiment_sum2[k];
+    }
+  *time_mean = nt ? *time_mean / nt : 0.;
+  n = (double) ne;
+  *mean = ne ? s / n : 0.;
+  *deviation = (ne > 1) ? sqrt (fmax (0., (s2 - s * *mean) / (n - 1.))) : 0.;
+  return ne;
+}
+
+/**
+ * Function to reorder the experiments to calculate first the most
+ *   discriminating per unit time. The experiments are sorted by decreasing
+ *   ratio of the standard deviation of its objective function values to its
+ *   mean calculation time, so that the simulations to prune are rejected
+ *   spending the minimum simulation time. Experiments without statistics keep
+ *   their relative order at the end.
+ */
+static void
+optimize_order ()
+{
+  double *score;
+  double time_mean, mean, deviation, s;
+  unsigned int i, j, k;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_order: start\n");
+#endif
+  score = optimize->experiment_score;
+  for (i = 0; i < optimize->nexperiments; ++i)
+    {
+      score[i] = -1.;
+      if (optimize_experiment_statistics (i, &time_mean, &mean, &deviation)
+          > 1)
+        score[i] = deviation / fmax (time_mean, 0.000001);
+    }
+  for (i = 1; i < optimize->nexperiments; ++i)
+    {
+      k = optimize->experiment_order[i];
+      s = score[k];
+      for (j = i; j > 0 && score[optimize->experiment_order[j - 1]] < s; --j)
+        optimize->experiment_order[j] = optimize->experiment_order[j - 1];
+      optimize->experiment_order[j] = k;
+    }
+#if DEBUG_OPTIMIZE
+  for (i = 0; i < optimize->nexperiments; ++i)
+    fprintf (stderr, "optimize_order: i=%u experiment=%u score=%lg\n", i,
+             optimize->experiment_order[i],
+             score[optimize->experiment_order[i]]);
+  fprintf (stderr, "optimize_order: end\n");
+#endif
+}
+
+/**
+ * Function to calculate a task with branch and bound pruning. A simulation is
+ *   pruned when the error norm of its finished experiments, a lower bound of
+ *   its error norm, can not enter the best simulations set, and then its
+ *   pending experiments are not calculated.
+ *
+ * \return 1 if the simulation is finished, 0 otherwise.
+ */
+static int
+optimize_task_pruned (ParallelData * data,      ///< Thread data.
+                      unsigned int simulation,  ///< Simulation number.
+                      unsigned int experiment,  ///< Experiment number.
+                      double *e)
+                      ///< Pointer to the error norm, NAN if pruned.
+{
+  GMutex *lock;
+  double *error;
+  double bound, ei = 0.;
+  int left;
+  unsigned char pruned;
+  lock = optimize->mutex_simulation + simulation % NLOCKS;
+  error = optimize->error_experiment + simulation * optimize->nexperiments;
+  g_mutex_lock (lock);
+  pruned = optimize->pruned[simulation];
+  g_mutex_unlock (lock);
+  if (pruned)
+    g_atomic_int_inc (&optimize->nexperiments_pruned);
+  else
+    ei = optimize_experiment (data, simulation, experiment);
+  bound = data->bound;
+  if (data->nsaveds && data->nsaveds == data->nbest)
+    bound = fmin (bound, data->error_best[0]);
+  g_mutex_lock (lock);
+  left = --optimize->nexperiments_left[simulation];
+  if (!pruned)
+    {
+      error[experiment] = ei;
+      if (left && !optimize->pruned[simulation]
+          && optimize_norm (error, optimize->nexperiments) > bound)
+        optimize->pruned[simulation] = 1;
+    }
+  pruned = optimize->pruned[simulation];
+  g_mutex_unlock (lock);
+  if (left)
+    return 0;
+  *e = pruned ? NAN : optimize_norm (error, optimize->nexperiments);
+  return 1;
+}
+
+/**
+ * Function to save a finished simulation of a pipelined pass in the shared best
+ *   simulations.
+ */
+static void
+optimize_pipeline_finish (ParallelData * data,  ///< Thread data.
+                          unsigned int simulation,      ///< Simulation number.
+                          double e)     ///< Error norm, NAN if pruned.
+{
+  g_mutex_lock (optimize->pool_mutex);
+  if (!isnan (e))
+    optimize_best (optimize->pipeline_best, simulation, e);
+  --optimize->nleft[data->pass];
+  g_cond_signal (optimize->pool_cond);
+  g_mutex_unlock (optimize->pool_mutex);
+}
+
+/**
+ * Function to optimize on a thread. Every task is an experiment of a
+ *   simulation and the thread finishing the last experiment of a simulation
+ *   reduces the experiment errors to the error norm.
+ *
+ * \return NULL.
+ */
+static void *
+optimize_thread (ParallelData * data)   ///< Function data.
+{
+  unsigned int i, j, k;
+  double e;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_thread: start\n");
+  fprintf (stderr, "optimize_thread: thread=%u\n", data->thread);
+#endif
+  while (optimize_next (data, &k))
+    {
+      i = k / optimize->nexperiments;
+      j = optimize->experiment_order[k % optimize->nexperiments];
+      if (optimize->prune)
+        {
+          if (!optimize_task_pruned (data, i, j, &e))
+            continue;
+          if (isnan (e))
+            {
+              g_atomic_int_inc (&optimize->nsimulations_pruned);
+              optimize_save_variables (i, e);
+              if (optimize->pipelined)
+                optimize_pipeline_finish (data, i, e);
+              continue;
+            }
+        }
+      else
+        {
+          optimize->error_experiment[i * optimize->nexperiments + j]
+            = optimize_experiment (data, i, j);
+          if (!g_atomic_int_dec_and_test (optimize->nexperiments_left + i))
+            continue;
+          e = optimize_norm (optimize->error_experiment
+                             + i * optimize->nexperiments,
+                             optimize->nexperiments);
+        }
+      if (optimize->pipelined)
+        {
+          optimize_save_variables (i, e);
+          optimize_pipeline_finish (data, i, e);
+        }
+      else
+        {
+          optimize_best (data, i, e);
+          optimize_save_variables (i, e);
+        }
+      if (e < optimize->threshold)
+        optimize->stop = 1;
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_thread: i=%u e=%lg\n", i, e);
+#endif
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_thread: end\n");
+#endif
+  return NULL;
 }
 
 /**
  * Function to merge the 2 optimization results.
  */
-static inline void
-optimize_merge (unsigned int nsaveds,   ///< Number of saved results.
-                unsigned int *simulation_best,
-                ///< Array of best simulation numbers.
-                double *error_best)
-                ///< Array of best objective function values.
+static void
+optimize_merge (unsigned int nsaveds,   ///< Number of saved results.
+                unsigned int *simulation_best,
+                ///< Array of best simulation numbers.
+                double *error_best)
+                ///< Array of best objective function values.
+{
+  unsigned int i, j, k, *s;
+  double *e;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_merge: start\n");
+#endif
+  if (!nsaveds)
+    return;
+  s = optimize->simulation_merge;
+  e = optimize->error_merge;
+  i = j = k = 0;
+  do
+    {
+      if (i == optimize->nsaveds)
+        {
+          s[k] = simulation_best[j];
+          e[k] = error_best[j];
+          ++j;
+          ++k;
+          if (j == nsaveds)
+            break;
+        }
+      else if (j == nsaveds)
+        {
+          s[k] = optimize->simulation_best[i];
+          e[k] = optimize->error_best[i];
+          ++i;
+          ++k;
+          if (i == optimize->nsaveds)
+            break;
+        }
+      else if (optimize->error_best[i] > error_best[j])
+        {
+          s[k] = simulation_best[j];
+          e[k] = error_best[j];
+          ++j;
+          ++k;
+        }
+      else
+        {
+          s[k] = optimize->simulation_best[i];
+          e[k] = optimize->error_best[i];
+          ++i;
+          ++k;
+        }
+    }
+  while (k < optimize->nbest);
+  optimize->nsaveds = k;
+  memcpy (optimize->simulation_best, s, k * sizeof (unsigned int));
+  memcpy (optimize->error_best, e, k * sizeof (double));
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_merge: end\n");
+#endif
+}
+
+/**
+ * Function to merge the best results of a thread in a hill climbing method.
+ */
+static void
+optimize_merge_climbing (unsigned int nsaveds,  ///< Number of saved results.
+                         unsigned int *simulation_best,
+                         ///< Array of best simulation numbers.
+                         double *error_best)
+                         ///< Array of best objective function values.
+{
+  unsigned int i;
+  for (i = 0; i < nsaveds; ++i)
+    optimize_best_climbing (simulation_best[i], error_best[i]);
+}
+
+/**
+ * Function to run a job on a thread of the pool.
+ */
+static void
+optimize_pool_run (ParallelData * data, ///< Function data.
+                   gpointer user_data __attribute__((unused)))
+  ///< Unused pool data.
+{
+  optimize_thread (data);
+  g_mutex_lock (optimize->pool_mutex);
+  if (!--optimize->npending[data->pass])
+    g_cond_signal (optimize->pool_cond);
+  g_mutex_unlock (optimize->pool_mutex);
+}
+
+/**
+ * Function to calculate a range of simulations on a set of threads. Every
+ * thread takes the next simulation from a shared counter, so the threads are
+ * balanced although the simulation times differ. The jobs run on the
+ * persistent threads of the pool, the number of threads limiting the number
+ * of concurrent jobs. The experiments of a simulation are distributed as
+ * independent tasks, so a pass with less simulations than threads uses all
+ * the threads. Every thread saves its best simulations without locks and the
+ * results are merged at the end of the pass.
+ */
+static void
+optimize_parallel (void (*merge) (unsigned int, unsigned int *, double *),
+                   ///< Function to merge the results of a thread.
+                   unsigned int nbest,  ///< Number of best simulations.
+                   double bound,
+                   ///< Objective function value to prune the simulations.
+                   unsigned int nstart, ///< Beginning simulation number.
+                   unsigned int nend,   ///< Ending simulation number.
+                   unsigned int n)      ///< Number of threads.
+{
+  ParallelData *data;
+  gint64 t;
+  unsigned int i;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_parallel: start\n");
+  fprintf (stderr, "optimize_parallel: nstart=%u nend=%u n=%u\n",
+           nstart, nend, n);
+#endif
+  data = optimize->parallel_data;
+  optimize->nnext[0] = nstart * optimize->nexperiments;
+  optimize->nlast[0] = nend * optimize->nexperiments;
+  for (i = nstart; i < nend; ++i)
+    optimize->nexperiments_left[i] = (int) optimize->nexperiments;
+  if (optimize->prune)
+    {
+      memset (optimize->pruned + nstart, 0, nend - nstart);
+      memset (optimize->error_experiment + nstart * optimize->nexperiments, 0,
+              (nend - nstart) * optimize->nexperiments * sizeof (double));
+    }
+  for (i = 0; i < n; ++i)
+    {
+      data[i].simulation_best = optimize->simulation_heap + i * nbest;
+      data[i].error_best = optimize->error_heap + i * nbest;
+      data[i].bound = bound;
+      data[i].busy = 0;
+      data[i].nbest = nbest;
+      data[i].nsaveds = 0;
+      data[i].thread = i;
+      data[i].pass = 0;
+    }
+  t = g_get_monotonic_time ();
+  if (n <= 1 || !optimize->pool)
+    for (i = 0; i < n; ++i)
+      optimize_thread (data + i);
+  else
+    {
+      optimize->npending[0] = n;
+      for (i = 0; i < n; ++i)
+        g_thread_pool_push (optimize->pool, data + i, NULL);
+      g_mutex_lock (optimize->pool_mutex);
+      while (optimize->npending[0])
+        g_cond_wait (optimize->pool_cond, optimize->pool_mutex);
+      g_mutex_unlock (optimize->pool_mutex);
+    }
+  t = g_get_monotonic_time () - t;
+  for (i = 0; i < n; ++i)
+    {
+      optimize->time_busy[i] += 0.000001 * data[i].busy;
+      optimize->time_idle[i] += 0.000001 * (t - data[i].busy);
+      optimize_best_sort (data + i);
+      merge (data[i].nsaveds, data[i].simulation_best, data[i].error_best);
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_parallel: end\n");
+#endif
+}
+
+/**
+ * Function to start an asynchronous pass on the threads of the pool, without
+ *   waiting for the end of the simulations. The finished simulations are saved
+ *   in the shared best simulations. The rows of the simulations of the pass
+ *   have to be free, see optimize_pipeline_wait(). Without pool the pass is
+ *   calculated before returning.
+ */
+static void
+optimize_pipeline_start (unsigned int pass,     ///< Pass number.
+                         unsigned int nstart, ///< Beginning simulation number.
+                         unsigned int nend,     ///< Ending simulation number.
+                         double bound)
+                         ///< Objective function value to prune the simulations.
+{
+  ParallelData *data;
+  unsigned int i;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_pipeline_start: start\n");
+  fprintf (stderr,
+           "optimize_pipeline_start: pass=%u nstart=%u nend=%u bound=%lg\n",
+           pass, nstart, nend, bound);
+#endif
+  optimize->nnext[pass] = nstart * optimize->nexperiments;
+  optimize->nlast[pass] = nend * optimize->nexperiments;
+  for (i = nstart; i < nend; ++i)
+    optimize->nexperiments_left[i] = (int) optimize->nexperiments;
+  if (optimize->prune)
+    {
+      memset (optimize->pruned + nstart, 0, nend - nstart);
+      memset (optimize->error_experiment + nstart * optimize->nexperiments, 0,
+              (nend - nstart) * optimize->nexperiments * sizeof (double));
+    }
+  data = optimize->pipeline_data + pass * optimize->nworkers;
+  for (i = 0; i < optimize->nworkers; ++i)
+    {
+      data[i].simulation_best = NULL;
+      data[i].error_best = NULL;
+      data[i].bound = bound;
+      data[i].busy = 0;
+      data[i].nbest = data[i].nsaveds = 0;
+      data[i].thread = pass * optimize->nworkers + i;
+      data[i].pass = pass;
+    }
+  g_mutex_lock (optimize->pool_mutex);
+  optimize->nleft[pass] = nend - nstart;
+  optimize->npending[pass] = optimize->nworkers;
+  g_mutex_unlock (optimize->pool_mutex);
+  if (optimize->pool)
+    for (i = 0; i < optimize->nworkers; ++i)
+      g_thread_pool_push (optimize->pool, data + i, NULL);
+  else
+    {
+      for (i = 0; i < optimize->nworkers; ++i)
+        optimize_thread (data + i);
+      optimize->npending[pass] = 0;
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_pipeline_start: end\n");
+#endif
+}
+
+/**
+ * Function to wait for a number of finished simulations of a pipelined pass.
+ *   It also returns when all the jobs of the pass are ended, so that the rows
+ *   of the simulations of the pass can be reused, and then the busy times of
+ *   the jobs are added to the thread load statistics.
+ */
+static void
+optimize_pipeline_wait (unsigned int pass,      ///< Pass number.
+                        unsigned int nfinished)
+                        ///< Number of finished simulations, 0 to wait for the
+                        ///< end of all the jobs.
+{
+  ParallelData *data;
+  unsigned int i;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_pipeline_wait: start\n");
+  fprintf (stderr, "optimize_pipeline_wait: pass=%u nfinished=%u\n", pass,
+           nfinished);
+#endif
+  g_mutex_lock (optimize->pool_mutex);
+  while (optimize->npending[pass]
+         && (!nfinished
+             || optimize->nsimulations - optimize->nleft[pass] < nfinished))
+    g_cond_wait (optimize->pool_cond, optimize->pool_mutex);
+  g_mutex_unlock (optimize->pool_mutex);
+  if (!nfinished)
+    {
+      data = optimize->pipeline_data + pass * optimize->nworkers;
+      for (i = 0; i < optimize->nworkers; ++i)
+        {
+          optimize->time_busy[i] += 0.000001 * data[i].busy;
+          data[i].busy = 0;
+        }
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_pipeline_wait: end\n");
+#endif
+}
+
+/**
+ * Function to collect the best simulations finished on the pipelined passes
+ *   since the last collection. The best simulations set is filled with
+ *   infinite errors up to the number of best simulations.
+ */
+static void
+optimize_pipeline_collect ()
+{
+  unsigned int i;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_pipeline_collect: start\n");
+#endif
+  g_mutex_lock (optimize->pool_mutex);
+  optimize_best_sort (optimize->pipeline_best);
+  optimize->nsaveds = optimize->pipeline_best->nsaveds;
+  memcpy (optimize->simulation_best, optimize->pipeline_best->simulation_best,
+          optimize->nsaveds * sizeof (unsigned int));
+  memcpy (optimize->error_best, optimize->pipeline_best->error_best,
+          optimize->nsaveds * sizeof (double));
+  optimize->pipeline_best->nsaveds = 0;
+  g_mutex_unlock (optimize->pool_mutex);
+  for (i = optimize->nsaveds; i < optimize->nbest; ++i)
+    {
+      optimize->simulation_best[i] = 0;
+      optimize->error_best[i] = INFINITY;
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_pipeline_collect: nsaveds=%u\n",
+           optimize->nsaveds);
+  fprintf (stderr, "optimize_pipeline_collect: end\n");
+#endif
+}
+
+/**
+ * Function to synchronise the optimization results of MPI tasks or local
+ *   processes. The best simulations of every task are merged on the master
+ *   task with a custom reduction and the stop flag is reduced on all the tasks.
+ */
+static void
+optimize_synchronise ()
+{
+  Best *best, *merged;
+  unsigned int i, stop;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_synchronise: start\n");
+#endif
+  best = optimize->best_task;
+  merged = optimize->best_merged;
+  best_fill (best, optimize->simulation_best, optimize->error_best,
+             optimize->nsaveds, optimize->nbest);
+#if HAVE_MPI
+  MPI_Reduce (best, merged, 1, optimize->mpi_best_type, optimize->mpi_best_op,
+              0, MPI_COMM_WORLD);
+#else
+  memcpy (merged, best, optimize->nbest * sizeof (Best));
+  if (!process_reduce_best (merged, optimize->nbest))
+    optimize->stop = 1;
+#endif
+  if (optimize->rank == 0)
+    {
+      for (i = 0; i < optimize->nbest && merged[i].simulation >= 0; ++i)
+        {
+          optimize->simulation_best[i] = (unsigned int) merged[i].simulation;
+          optimize->error_best[i] = merged[i].error;
+        }
+      optimize->nsaveds = i;
+      for (; i < optimize->nbest; ++i)
+        {
+          optimize->simulation_best[i] = 0;
+          optimize->error_best[i] = INFINITY;
+        }
+    }
+#if HAVE_MPI
+  MPI_Allreduce (&optimize->stop, &stop, 1, MPI_UNSIGNED, MPI_MAX,
+                 MPI_COMM_WORLD);
+#else
+  stop = optimize->stop;
+  if (!process_reduce_max (&stop))
+    stop = 1;
+#endif
+  if (stop)
+    optimize->stop = 1;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_synchronise: end\n");
+#endif
+}
+
+/**
+ * Function to gather on all the MPI tasks or local processes an array of
+ *   objective function values. Every task fills its own values and sets the
+ *   rest to -INFINITY, so the maximum of every element is the calculated one.
+ */
+static void
+optimize_gather (double *error, ///< Array of objective function values.
+                 unsigned int n)        ///< Number of values.
 {
-  unsigned int i, j, k, s[optimize->nbest];
-  double e[optimize->nbest];
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_merge: start\n");
+  fprintf (stderr, "optimize_gather: start\n");
 #endif
-  i = j = k = 0;
-  do
+#if HAVE_MPI
+  MPI_Allreduce (MPI_IN_PLACE, error, n, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+  if (!process_reduce_max_array (error, n))
+    optimize->stop = 1;
+#endif
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_gather: end\n");
+#endif
+}
+
+#if HAVE_MPI
+
+/**
+ * Function to wait for the end of the local jobs of a dynamic MPI pass a
+ *   maximum polling time.
+ *
+ * \return 1 if the local jobs are ended, 0 otherwise.
+ */
+static int
+optimize_dynamic_poll (unsigned int running)
+                       ///< 1 if the local jobs are running, 0 otherwise.
+{
+  int ended;
+  if (!running)
     {
-      if (i == optimize->nsaveds)
-        {
-          s[k] = simulation_best[j];
-          e[k] = error_best[j];
-          ++j;
-          ++k;
-          if (j == nsaveds)
-            break;
-        }
-      else if (j == nsaveds)
+      g_usleep (SCHEDULE_POLL_TIME);
+      return 1;
+    }
+  g_mutex_lock (optimize->pool_mutex);
+  if (optimize->npending[0])
+    g_cond_wait_until (optimize->pool_cond, optimize->pool_mutex,
+                       g_get_monotonic_time () + SCHEDULE_POLL_TIME);
+  ended = !optimize->npending[0];
+  g_mutex_unlock (optimize->pool_mutex);
+  if (ended)
+    optimize_pipeline_wait (0, 0);
+  return ended;
+}
+
+/**
+ * Function to coordinate a dynamic MPI pass on the master task. The master
+ *   task hands out chunks of simulations to the other tasks on demand and to
+ *   its own threads, and sends the threshold stop to the working tasks as
+ *   soon as it is known. All the messages are non-blocking.
+ */
+static void
+optimize_dynamic_master ()
+{
+  MPI_Request request, *reply;
+  MPI_Status mpi_stat;
+  unsigned int received[3], *message;
+  unsigned int i, next, nstart, nworking, running, stopped;
+  int flag;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_dynamic_master: start\n");
+#endif
+  message = (unsigned int *) g_malloc0 (3 * ntasks * sizeof (unsigned int));
+  reply = (MPI_Request *) g_malloc (ntasks * sizeof (MPI_Request));
+  for (i = 0; (int) i < ntasks; ++i)
+    reply[i] = MPI_REQUEST_NULL;
+  next = running = stopped = 0;
+  nworking = ntasks - 1;
+  MPI_Irecv (received, 3, MPI_UNSIGNED, MPI_ANY_SOURCE, SCHEDULE_TAG,
+             MPI_COMM_WORLD, &request);
+  while (nworking || running)
+    {
+      // Handing out a chunk to the own threads
+      if (!running && !optimize->stop && next < optimize->nsimulations)
         {
-          s[k] = optimize->simulation_best[i];
-          e[k] = optimize->error_best[i];
-          ++i;
-          ++k;
-          if (i == optimize->nsaveds)
-            break;
+          nstart = next;
+          next = JBM_MIN (next + optimize->chunk, optimize->nsimulations);
+          optimize_pipeline_start (0, nstart, next, optimize->bound);
+          running = 1;
         }
-      else if (optimize->error_best[i] > error_best[j])
+
+      // Serving the messages of the working tasks
+      flag = 0;
+      if (nworking)
+        MPI_Test (&request, &flag, &mpi_stat);
+      while (flag)
         {
-          s[k] = simulation_best[j];
-          e[k] = error_best[j];
-          ++j;
-          ++k;
+          i = (unsigned int) mpi_stat.MPI_SOURCE;
+          if (received[1])
+            optimize->stop = 1;
+          if (received[0] == SCHEDULE_MESSAGE_REQUEST)
+            {
+              MPI_Wait (reply + i, MPI_STATUS_IGNORE);
+              if (optimize->stop || next >= optimize->nsimulations)
+                {
+                  message[3 * i] = SCHEDULE_MESSAGE_END;
+                  --nworking;
+                }
+              else
+                {
+                  message[3 * i] = SCHEDULE_MESSAGE_CHUNK;
+                  message[3 * i + 1] = next;
+                  next = JBM_MIN (next + optimize->chunk,
+                                  optimize->nsimulations);
+                  message[3 * i + 2] = next;
+                }
+              MPI_Isend (message + 3 * i, 3, MPI_UNSIGNED, i, SCHEDULE_TAG,
+                         MPI_COMM_WORLD, reply + i);
+            }
+          flag = 0;
+          if (nworking)
+            {
+              MPI_Irecv (received, 3, MPI_UNSIGNED, MPI_ANY_SOURCE,
+                         SCHEDULE_TAG, MPI_COMM_WORLD, &request);
+              MPI_Test (&request, &flag, &mpi_stat);
+            }
         }
-      else
+
+      // Sending the stop to the working tasks
+      if (optimize->stop && !stopped)
         {
-          s[k] = optimize->simulation_best[i];
-          e[k] = optimize->error_best[i];
-          ++i;
-          ++k;
+          stopped = 1;
+          for (i = 1; (int) i < ntasks; ++i)
+            if (message[3 * i] != SCHEDULE_MESSAGE_END)
+              {
+                MPI_Wait (reply + i, MPI_STATUS_IGNORE);
+                message[3 * i] = SCHEDULE_MESSAGE_STOP;
+                MPI_Isend (message + 3 * i, 3, MPI_UNSIGNED, i, SCHEDULE_TAG,
+                           MPI_COMM_WORLD, reply + i);
+              }
         }
+
+      // Waiting for the own threads
+      if (optimize_dynamic_poll (running))
+        running = 0;
     }
-  while (k < optimize->nbest);
-  optimize->nsaveds = k;
-  memcpy (optimize->simulation_best, s, k * sizeof (unsigned int));
-  memcpy (optimize->error_best, e, k * sizeof (double));
+  MPI_Waitall (ntasks, reply, MPI_STATUSES_IGNORE);
+  g_free (reply);
+  g_free (message);
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_merge: end\n");
+  fprintf (stderr, "optimize_dynamic_master: end\n");
 #endif
 }
 
 /**
- * Function to synchronise the optimization results of MPI tasks.
+ * Function to calculate a dynamic MPI pass on a worker task. The worker task
+ *   requests chunks of simulations to the master task until the end of the
+ *   pass, and it sends the threshold stop as soon as it is reached on its
+ *   threads. All the messages are non-blocking.
  */
-#if HAVE_MPI
 static void
-optimize_synchronise ()
+optimize_dynamic_worker ()
 {
-  unsigned int i, nsaveds, simulation_best[optimize->nbest], stop;
-  double error_best[optimize->nbest];
-  MPI_Status mpi_stat;
+  MPI_Request request, send;
+  unsigned int received[3], message[3];
+  unsigned int running, notified;
+  int flag;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_synchronise: start\n");
+  fprintf (stderr, "optimize_dynamic_worker: start\n");
 #endif
-  if (optimize->mpi_rank == 0)
+  running = notified = 0;
+  message[0] = SCHEDULE_MESSAGE_REQUEST;
+  message[1] = optimize->stop;
+  message[2] = 0;
+  MPI_Isend (message, 3, MPI_UNSIGNED, 0, SCHEDULE_TAG, MPI_COMM_WORLD, &send);
+  MPI_Irecv (received, 3, MPI_UNSIGNED, 0, SCHEDULE_TAG, MPI_COMM_WORLD,
+             &request);
+  for (;;)
     {
-      for (i = 1; (int) i < ntasks; ++i)
+      // Receiving the messages of the master task
+      MPI_Test (&request, &flag, MPI_STATUS_IGNORE);
+      if (flag)
         {
-          MPI_Recv (&nsaveds, 1, MPI_INT, i, 1, MPI_COMM_WORLD, &mpi_stat);
-          MPI_Recv (simulation_best, nsaveds, MPI_INT, i, 1,
-                    MPI_COMM_WORLD, &mpi_stat);
-          MPI_Recv (error_best, nsaveds, MPI_DOUBLE, i, 1,
-                    MPI_COMM_WORLD, &mpi_stat);
-          optimize_merge (nsaveds, simulation_best, error_best);
-          MPI_Recv (&stop, 1, MPI_UNSIGNED, i, 1, MPI_COMM_WORLD, &mpi_stat);
-          if (stop)
-            optimize->stop = 1;
+          if (received[0] == SCHEDULE_MESSAGE_END)
+            break;
+          if (received[0] == SCHEDULE_MESSAGE_STOP)
+            optimize->stop = notified = 1;
+          else
+            {
+              optimize_pipeline_start (0, received[1], received[2],
+                                       optimize->bound);
+              running = 1;
+            }
+          MPI_Irecv (received, 3, MPI_UNSIGNED, 0, SCHEDULE_TAG,
+                     MPI_COMM_WORLD, &request);
+          continue;
+        }
+
+      // Sending the stop reached on the own threads
+      if (running && optimize->stop && !notified)
+        {
+          notified = 1;
+          MPI_Wait (&send, MPI_STATUS_IGNORE);
+          message[0] = SCHEDULE_MESSAGE_STOP;
+          message[1] = 1;
+          MPI_Isend (message, 3, MPI_UNSIGNED, 0, SCHEDULE_TAG,
+                     MPI_COMM_WORLD, &send);
+        }
+
+      // Requesting a new chunk at the end of the own threads
+      if (optimize_dynamic_poll (running) && running)
+        {
+          running = 0;
+          MPI_Wait (&send, MPI_STATUS_IGNORE);
+          message[0] = SCHEDULE_MESSAGE_REQUEST;
+          message[1] = optimize->stop;
+          MPI_Isend (message, 3, MPI_UNSIGNED, 0, SCHEDULE_TAG,
+                     MPI_COMM_WORLD, &send);
         }
-      for (i = 1; (int) i < ntasks; ++i)
-        MPI_Send (&optimize->stop, 1, MPI_UNSIGNED, i, 1, MPI_COMM_WORLD);
     }
+  MPI_Wait (&send, MPI_STATUS_IGNORE);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_dynamic_worker: end\n");
+#endif
+}
+
+/**
+ * Function to calculate a sampling pass with the dynamic MPI scheduling.
+ */
+static void
+optimize_dynamic ()
+{
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_dynamic: start\n");
+#endif
+  optimize->pipeline_best->nsaveds = 0;
+  if (optimize->rank == 0)
+    optimize_dynamic_master ();
   else
-    {
-      MPI_Send (&optimize->nsaveds, 1, MPI_INT, 0, 1, MPI_COMM_WORLD);
-      MPI_Send (optimize->simulation_best, optimize->nsaveds, MPI_INT, 0, 1,
-                MPI_COMM_WORLD);
-      MPI_Send (optimize->error_best, optimize->nsaveds, MPI_DOUBLE, 0, 1,
-                MPI_COMM_WORLD);
-      MPI_Send (&optimize->stop, 1, MPI_UNSIGNED, 0, 1, MPI_COMM_WORLD);
-      MPI_Recv (&stop, 1, MPI_UNSIGNED, 0, 1, MPI_COMM_WORLD, &mpi_stat);
-      if (stop)
-        optimize->stop = 1;
-    }
+    optimize_dynamic_worker ();
+  optimize_pipeline_collect ();
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_synchronise: end\n");
+  fprintf (stderr, "optimize_dynamic: end\n");
 #endif
 }
 #endif
 
 /**
- * Function to optimize with the sweep algorithm.
+ * Function to sample the simulations of the sweep algorithm.
  */
 static void
-optimize_sweep ()
+optimize_sweep (double *value)  ///< Array of variable values to sample.
 {
-  ParallelData data[nthreads];
-  GThread *thread[nthreads];
-  double range[optimize->nvariables];
+  double *range;
   double e;
   unsigned int i, j, k, l;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_sweep: start\n");
 #endif
+  range = optimize->range;
   for (j = 0; j < optimize->nvariables; ++j)
     range[j] = (optimize->rangemax[j] - optimize->rangemin[j])
       / (optimize->nsweeps[j] - 1);
@@ -719,88 +2158,50 @@ optimize_sweep ()
           e = optimize->rangemin[j];
           if (optimize->nsweeps[j] > 1)
             e += l * range[j];
-          optimize->value[i * optimize->nvariables + j] = e;
-        }
-    }
-  optimize->nsaveds = 0;
-  if (nthreads <= 1)
-    optimize_sequential ();
-  else
-    {
-      for (i = 0; i < nthreads; ++i)
-        {
-          data[i].thread = i;
-          thread[i]
-            = g_thread_new (NULL, (GThreadFunc) optimize_thread, &data[i]);
+          value[i * optimize->nvariables + j] = e;
         }
-      for (i = 0; i < nthreads; ++i)
-        g_thread_join (thread[i]);
     }
-#if HAVE_MPI
-  // Communicating tasks results
-  optimize_synchronise ();
-#endif
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_sweep: end\n");
 #endif
 }
 
 /**
- * Function to optimize with the Monte-Carlo algorithm.
+ * Function to sample the simulations of the Monte-Carlo algorithm.
  */
 static void
-optimize_MonteCarlo ()
+optimize_MonteCarlo (double *value)     ///< Array of variable values to sample.
 {
-  ParallelData data[nthreads];
-  GThread *thread[nthreads];
-  double range[optimize->nvariables];
+  double *range;
   unsigned int i, j;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_MonteCarlo: start\n");
 #endif
+  range = optimize->range;
   for (j = 0; j < optimize->nvariables; ++j)
     range[j] = optimize->rangemax[j] - optimize->rangemin[j];
   for (i = 0; i < optimize->nsimulations; ++i)
     for (j = 0; j < optimize->nvariables; ++j)
-      optimize->value[i * optimize->nvariables + j]
+      value[i * optimize->nvariables + j]
         = optimize->rangemin[j] + gsl_rng_uniform (optimize->rng) * range[j];
-  optimize->nsaveds = 0;
-  if (nthreads <= 1)
-    optimize_sequential ();
-  else
-    {
-      for (i = 0; i < nthreads; ++i)
-        {
-          data[i].thread = i;
-          thread[i]
-            = g_thread_new (NULL, (GThreadFunc) optimize_thread, &data[i]);
-        }
-      for (i = 0; i < nthreads; ++i)
-        g_thread_join (thread[i]);
-    }
-#if HAVE_MPI
-  // Communicating tasks results
-  optimize_synchronise ();
-#endif
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_MonteCarlo: end\n");
 #endif
 }
 
 /**
- * Function to optimize with the orthogonal sampling algorithm.
+ * Function to sample the simulations of the orthogonal sampling algorithm.
  */
 static void
-optimize_orthogonal ()
+optimize_orthogonal (double *value)     ///< Array of variable values to sample.
 {
-  ParallelData data[nthreads];
-  GThread *thread[nthreads];
-  double range[optimize->nvariables];
+  double *range;
   double e;
   unsigned int i, j, k, l;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_orthogonal: start\n");
 #endif
+  range = optimize->range;
   for (j = 0; j < optimize->nvariables; ++j)
     range[j] = (optimize->rangemax[j] - optimize->rangemin[j])
       / optimize->nsweeps[j];
@@ -814,153 +2215,492 @@ optimize_orthogonal ()
           e = optimize->rangemin[j];
           if (optimize->nsweeps[j] > 1)
             e += (l + gsl_rng_uniform (optimize->rng)) * range[j];
-          optimize->value[i * optimize->nvariables + j] = e;
+          value[i * optimize->nvariables + j] = e;
         }
     }
-  optimize->nsaveds = 0;
-  if (nthreads <= 1)
-    optimize_sequential ();
-  else
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_orthogonal: end\n");
+#endif
+}
+
+/**
+ * Function to calculate the parity of the bits of an integer.
+ *
+ * \return 1 on an odd number of set bits, 0 otherwise.
+ */
+static inline guint32
+optimize_parity (guint32 x)     ///< Integer.
+{
+  x ^= x >> 16;
+  x ^= x >> 8;
+  x ^= x >> 4;
+  x ^= x >> 2;
+  x ^= x >> 1;
+  return x & 1u;
+}
+
+/**
+ * Function to sample the simulations of the scrambled Sobol algorithm. At
+ *   every iteration the Sobol sequence is scrambled with the random linear
+ *   scrambling of Matousek: the binary digits of every variable are multiplied
+ *   by a random lower triangular matrix with unit diagonal and a random digital
+ *   shift is added, keeping the low discrepancy of the sequence.
+ */
+static void
+optimize_sobol (double *value)  ///< Array of variable values to sample.
+{
+  double *range, *q;
+  guint32 *matrix, *row;
+  gsl_qrng *qrng;
+  guint32 k, x;
+  unsigned int i, j, l;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_sobol: start\n");
+#endif
+
+  // Generating the random scrambling matrix rows, from the most significant
+  // digit, and the random digital shift of every variable
+  range = optimize->range;
+  q = optimize->sobol_point;
+  matrix = (guint32 *) g_malloc (optimize->nvariables * 33 * sizeof (guint32));
+  for (j = 0; j < optimize->nvariables; ++j)
+    {
+      range[j] = optimize->rangemax[j] - optimize->rangemin[j];
+      row = matrix + j * 33;
+      for (l = 0; l < 32; ++l)
+        row[l] = (1u << (31 - l))
+          | ((guint32) gsl_rng_get (optimize->rng) & ~((2u << (31 - l)) - 1u));
+      row[32] = (guint32) gsl_rng_get (optimize->rng);
+    }
+
+  // Sampling the scrambled sequence
+  qrng = gsl_qrng_alloc (gsl_qrng_sobol, optimize->nvariables);
+  for (i = 0; i < optimize->nsimulations; ++i)
     {
-      for (i = 0; i < nthreads; ++i)
+      gsl_qrng_get (qrng, q);
+      for (j = 0; j < optimize->nvariables; ++j)
         {
-          data[i].thread = i;
-          thread[i]
-            = g_thread_new (NULL, (GThreadFunc) optimize_thread, &data[i]);
+          row = matrix + j * 33;
+          k = (guint32) ldexp (q[j], 32);
+          for (l = 0, x = row[32]; l < 32; ++l)
+            x ^= optimize_parity (k & row[l]) << (31 - l);
+          value[i * optimize->nvariables + j]
+            = optimize->rangemin[j] + ldexp ((double) x, -32) * range[j];
         }
-      for (i = 0; i < nthreads; ++i)
-        g_thread_join (thread[i]);
     }
-#if HAVE_MPI
-  // Communicating tasks results
-  optimize_synchronise ();
-#endif
+  gsl_qrng_free (qrng);
+  g_free (matrix);
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_orthogonal: end\n");
+  fprintf (stderr, "optimize_sobol: end\n");
 #endif
 }
 
 /**
- * Function to save the best simulation in a hill climbing method.
+ * Function to sample the simulations of the Latin hypercube algorithm. The
+ *   range of every variable is divided in as many intervals as simulations,
+ *   and every interval is sampled once in a random order.
  */
 static void
-optimize_best_climbing (unsigned int simulation,        ///< Simulation number.
-                        double value)   ///< Objective function value.
+optimize_latin (double *value)  ///< Array of variable values to sample.
 {
+  double range;
+  unsigned int *interval;
+  unsigned int i, j;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_best_climbing: start\n");
-  fprintf (stderr,
-           "optimize_best_climbing: simulation=%u value=%.14le best=%.14le\n",
-           simulation, value, optimize->error_best[0]);
+  fprintf (stderr, "optimize_latin: start\n");
 #endif
-  if (value < optimize->error_best[0])
+  interval = (unsigned int *)
+    g_malloc (optimize->nsimulations * sizeof (unsigned int));
+  for (j = 0; j < optimize->nvariables; ++j)
     {
-      optimize->error_best[0] = value;
-      optimize->simulation_best[0] = simulation;
-#if DEBUG_OPTIMIZE
-      fprintf (stderr,
-               "optimize_best_climbing: BEST simulation=%u value=%.14le\n",
-               simulation, value);
-#endif
+      range = (optimize->rangemax[j] - optimize->rangemin[j])
+        / optimize->nsimulations;
+      for (i = 0; i < optimize->nsimulations; ++i)
+        interval[i] = i;
+      gsl_ran_shuffle (optimize->rng, interval, optimize->nsimulations,
+                       sizeof (unsigned int));
+      for (i = 0; i < optimize->nsimulations; ++i)
+        value[i * optimize->nvariables + j] = optimize->rangemin[j]
+          + (interval[i] + gsl_rng_uniform (optimize->rng)) * range;
     }
+  g_free (interval);
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_best_climbing: end\n");
+  fprintf (stderr, "optimize_latin: end\n");
 #endif
 }
 
 /**
- * Function to estimate the hill climbing sequentially.
+ * Function to calculate the expected improvement of a candidate of the
+ *   surrogate algorithm. The objective function is modelled by a gaussian
+ *   process fitted to the nearest evaluated points, so the cost of a
+ *   prediction grows linearly with the number of evaluated points.
+ *
+ * \return expected improvement.
  */
-static inline void
-optimize_climbing_sequential (unsigned int simulation)  ///< Simulation number.
+static double
+optimize_surrogate_improvement (double *x)
+                                ///< Array of variable values of the candidate.
+{
+  double d2[SURROGATE_NNEIGHBOURS], y[SURROGATE_NNEIGHBOURS],
+    r[SURROGATE_NNEIGHBOURS],
+    L[SURROGATE_NNEIGHBOURS * SURROGATE_NNEIGHBOURS];
+  unsigned int neighbour[SURROGATE_NNEIGHBOURS];
+  double *p, *q, d, e, l2, mean, variance, mu, s;
+  unsigned int i, j, k, n;
+
+  // Finding the nearest evaluated points
+  n = JBM_MIN (SURROGATE_NNEIGHBOURS, optimize->nsurrogates);
+  for (i = k = 0; i < optimize->nsurrogates; ++i)
+    {
+      p = optimize->surrogate_value + i * optimize->nvariables;
+      for (j = 0, d = 0.; j < optimize->nvariables; ++j)
+        {
+          e = (x[j] - p[j]) * optimize->surrogate_scale[j];
+          d += e * e;
+          if (k == n && d >= d2[n - 1])
+            break;
+        }
+      if (j < optimize->nvariables)
+        continue;
+      if (k < n)
+        j = k++;
+      else
+        j = n - 1;
+      for (; j > 0 && d2[j - 1] > d; --j)
+        {
+          d2[j] = d2[j - 1];
+          neighbour[j] = neighbour[j - 1];
+        }
+      d2[j] = d;
+      neighbour[j] = i;
+    }
+
+  // Normalizing the objective function values
+  for (i = 0, mean = 0.; i < n; ++i)
+    {
+      y[i] = optimize->surrogate_error[neighbour[i]];
+      mean += y[i];
+    }
+  mean /= n;
+  for (i = 0, variance = 0.; i < n; ++i)
+    {
+      y[i] -= mean;
+      variance += y[i] * y[i];
+    }
+  variance /= n;
+  if (!(variance > 0.))
+    return fmax (optimize->surrogate_best - mean, 0.);
+
+  // Factorizing the correlation matrix by the Cholesky method, the correlation
+  // length is the distance to the farthest neighbour
+  l2 = 2. * fmax (d2[n - 1], DBL_EPSILON);
+  for (i = 0; i < n; ++i)
+    {
+      p = optimize->surrogate_value + neighbour[i] * optimize->nvariables;
+      for (j = 0; j <= i; ++j)
+        {
+          q = optimize->surrogate_value + neighbour[j] * optimize->nvariables;
+          for (k = 0, d = 0.; k < optimize->nvariables; ++k)
+            {
+              e = (p[k] - q[k]) * optimize->surrogate_scale[k];
+              d += e * e;
+            }
+          e = exp (-d / l2);
+          if (i == j)
+            e += DEFAULT_SURROGATE_NUGGET;
+          for (k = 0; k < j; ++k)
+            e -= L[i * n + k] * L[j * n + k];
+          if (i == j)
+            L[i * n + i] = sqrt (fmax (e, DBL_EPSILON));
+          else
+            L[i * n + j] = e / L[j * n + j];
+        }
+      r[i] = exp (-d2[i] / l2);
+    }
+
+  // Solving the triangular systems to predict the mean and the deviation
+  for (i = 0; i < n; ++i)
+    {
+      for (k = 0; k < i; ++k)
+        {
+          r[i] -= L[i * n + k] * r[k];
+          y[i] -= L[i * n + k] * y[k];
+        }
+      r[i] /= L[i * n + i];
+      y[i] /= L[i * n + i];
+    }
+  for (i = 0, mu = mean, s = 1. + DEFAULT_SURROGATE_NUGGET; i < n; ++i)
+    {
+      mu += r[i] * y[i];
+      s -= r[i] * r[i];
+    }
+  s = sqrt (variance * fmax (s, 0.));
+
+  // Expected improvement
+  d = optimize->surrogate_best - mu;
+  if (!(s > 0.))
+    return fmax (d, 0.);
+  e = d / s;
+  return d * 0.5 * erfc (-e * M_SQRT1_2)
+    + s * 0.5 * M_SQRT1_2 * M_2_SQRTPI * exp (-0.5 * e * e);
+}
+
+/**
+ * Function to calculate the expected improvements of a share of the candidates
+ *   of the surrogate algorithm.
+ */
+static void
+optimize_surrogate_share (unsigned int share)   ///< Share number.
+{
+  unsigned int i;
+  for (i = share * optimize->ncandidates / optimize->nthreads;
+       i < (share + 1) * optimize->ncandidates / optimize->nthreads; ++i)
+    optimize->candidate_improvement[i]
+      = optimize_surrogate_improvement (optimize->candidate_value
+                                        + i * optimize->nvariables);
+}
+
+/**
+ * Function to calculate a share of the expected improvements of the surrogate
+ *   algorithm on a thread of the pool.
+ */
+static void
+optimize_surrogate_run (gpointer data,  ///< Share number.
+                        gpointer user_data __attribute__((unused)))
+  ///< Unused pool data.
+{
+  optimize_surrogate_share (GPOINTER_TO_UINT (data));
+  g_mutex_lock (optimize->surrogate_mutex);
+  if (!--optimize->nsurrogate_pending)
+    g_cond_signal (optimize->surrogate_cond);
+  g_mutex_unlock (optimize->surrogate_mutex);
+}
+
+/**
+ * Function to compare the expected improvements of two candidates of the
+ *   surrogate algorithm, ordering them from the highest.
+ *
+ * \return -1, 0 or 1 as the first candidate goes before, equal or after.
+ */
+static int
+optimize_surrogate_compare (const void *a,      ///< 1st candidate number.
+                            const void *b)      ///< 2nd candidate number.
 {
-  double e;
   unsigned int i, j;
+  i = *(const unsigned int *) a;
+  j = *(const unsigned int *) b;
+  if (optimize->candidate_improvement[i] > optimize->candidate_improvement[j])
+    return -1;
+  if (optimize->candidate_improvement[i] < optimize->candidate_improvement[j])
+    return 1;
+  return (i > j) - (i < j);
+}
+
+/**
+ * Function to sample the simulations of the surrogate algorithm. Random
+ *   candidates in the search ranges are ranked by the expected improvement
+ *   predicted by the surrogate model, and the simulations are selected from
+ *   the best ones keeping a minimum distance between them, so that a parallel
+ *   pass does not sample several times the same promising region. Without
+ *   enough evaluated points the simulations are sampled as in the Monte-Carlo
+ *   algorithm.
+ */
+static void
+optimize_surrogate (double *value)      ///< Array of variable values to sample.
+{
+  unsigned int *order;
+  unsigned char *selected;
+  double *p, *q, d, e, diversity;
+  unsigned int i, j, k, l, pass;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_climbing_sequential: start\n");
-  fprintf (stderr, "optimize_climbing_sequential: nstart_climbing=%u "
-           "nend_climbing=%u\n",
-           optimize->nstart_climbing, optimize->nend_climbing);
+  fprintf (stderr, "optimize_surrogate: start\n");
+  fprintf (stderr, "optimize_surrogate: nsurrogates=%u\n",
+           optimize->nsurrogates);
 #endif
-  for (i = optimize->nstart_climbing; i < optimize->nend_climbing; ++i)
+  if (optimize->nsurrogates < optimize->nvariables + 2)
     {
-      j = simulation + i;
-      e = optimize_norm (j);
-      optimize_best_climbing (j, e);
-      optimize_save_variables (j, e);
-      if (e < optimize->threshold)
-        {
-          optimize->stop = 1;
-          break;
-        }
+      optimize_MonteCarlo (value);
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_surrogate: end\n");
+#endif
+      return;
+    }
+
+  // Sampling the candidates
+  for (j = 0; j < optimize->nvariables; ++j)
+    {
+      d = optimize->rangemax[j] - optimize->rangemin[j];
+      optimize->surrogate_scale[j] = (d > 0.) ? 1. / d : 1.;
+    }
+  optimize_MonteCarlo (optimize->candidate_value);
+  for (i = 1; i < SURROGATE_NCANDIDATES; ++i)
+    optimize_MonteCarlo (optimize->candidate_value
+                         + i * optimize->nsimulations * optimize->nvariables);
+
+  // Calculating the expected improvements on all the threads, the first share
+  // on the main thread
+  if (optimize->pool_surrogate)
+    {
+      optimize->nsurrogate_pending = optimize->nthreads - 1;
+      for (i = 1; i < optimize->nthreads; ++i)
+        g_thread_pool_push (optimize->pool_surrogate, GUINT_TO_POINTER (i),
+                            NULL);
+      optimize_surrogate_share (0);
+      g_mutex_lock (optimize->surrogate_mutex);
+      while (optimize->nsurrogate_pending)
+        g_cond_wait (optimize->surrogate_cond, optimize->surrogate_mutex);
+      g_mutex_unlock (optimize->surrogate_mutex);
+    }
+  else
+    for (i = 0; i < optimize->nthreads; ++i)
+      optimize_surrogate_share (i);
+
+  // Selecting the best candidates far enough from the selected ones, relaxing
+  // the distance in a second pass if there are not enough candidates
+  order = (unsigned int *)
+    g_malloc (optimize->ncandidates * sizeof (unsigned int));
+  selected = (unsigned char *) g_malloc0 (optimize->ncandidates);
+  for (i = 0; i < optimize->ncandidates; ++i)
+    order[i] = i;
+  qsort (order, optimize->ncandidates, sizeof (unsigned int),
+         optimize_surrogate_compare);
+  diversity = DEFAULT_SURROGATE_DIVERSITY
+    * pow ((double) optimize->nsimulations, -1. / optimize->nvariables);
+  diversity *= diversity;
+  for (pass = k = 0; pass < 2 && k < optimize->nsimulations; ++pass)
+    for (i = 0; i < optimize->ncandidates && k < optimize->nsimulations; ++i)
+      {
+        l = order[i];
+        if (selected[l])
+          continue;
+        p = optimize->candidate_value + l * optimize->nvariables;
+        if (!pass)
+          {
+            for (j = 0; j < k; ++j)
+              {
+                q = value + j * optimize->nvariables;
+                for (l = 0, d = 0.; l < optimize->nvariables; ++l)
+                  {
+                    e = (p[l] - q[l]) * optimize->surrogate_scale[l];
+                    d += e * e;
+                  }
+                if (d < diversity)
+                  break;
+              }
+            if (j < k)
+              continue;
+            l = order[i];
+          }
+        memcpy (value + k * optimize->nvariables, p,
+                optimize->nvariables * sizeof (double));
+        selected[l] = 1;
+        ++k;
+      }
 #if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_climbing_sequential: i=%u e=%lg\n", i, e);
+  fprintf (stderr, "optimize_surrogate: best improvement=%.14le\n",
+           optimize->candidate_improvement[order[0]]);
 #endif
-    }
+  g_free (selected);
+  g_free (order);
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_climbing_sequential: end\n");
+  fprintf (stderr, "optimize_surrogate: end\n");
 #endif
 }
 
 /**
- * Function to estimate the hill climbing on a thread.
- *
- * \return NULL
+ * Function to add the simulations of a pass to the points evaluated by the
+ *   surrogate algorithm. Every task knows only the objective function values of
+ *   its own simulations, so they are reduced on all the tasks. The pruned
+ *   simulations and the simulations not calculated after a stop are not added
+ *   because their objective function values are not complete.
  */
-static void *
-optimize_climbing_thread (ParallelData * data)  ///< Function data.
+static void
+optimize_surrogate_add ()
 {
-  unsigned int i, thread;
-  double e;
+  double *error;
+  unsigned int i;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_climbing_thread: start\n");
+  fprintf (stderr, "optimize_surrogate_add: start\n");
 #endif
-  thread = data->thread;
+  error = (double *) g_malloc (optimize->nsimulations * sizeof (double));
+  for (i = 0; i < optimize->nsimulations; ++i)
+    error[i] = -INFINITY;
+  for (i = optimize->nstart; i < optimize->nend; ++i)
+    if (optimize->nexperiments_left[i]
+        || (optimize->prune && optimize->pruned[i]))
+      error[i] = INFINITY;
+    else
+      error[i] = optimize_norm (optimize->error_experiment
+                                + i * optimize->nexperiments,
+                                optimize->nexperiments);
+  optimize_gather (error, optimize->nsimulations);
+  for (i = 0; i < optimize->nsimulations; ++i)
+    if (isfinite (error[i]))
+      {
+        memcpy (optimize->surrogate_value
+                + optimize->nsurrogates * optimize->nvariables,
+                optimize->value + i * optimize->nvariables,
+                optimize->nvariables * sizeof (double));
+        optimize->surrogate_error[optimize->nsurrogates++] = error[i];
+        optimize->surrogate_best = fmin (optimize->surrogate_best, error[i]);
+      }
+  g_free (error);
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_climbing_thread: thread=%u start=%u end=%u\n",
-           thread,
-           optimize->thread_climbing[thread],
-           optimize->thread_climbing[thread + 1]);
+  fprintf (stderr, "optimize_surrogate_add: nsurrogates=%u best=%.14le\n",
+           optimize->nsurrogates, optimize->surrogate_best);
+  fprintf (stderr, "optimize_surrogate_add: end\n");
 #endif
-  for (i = optimize->thread_climbing[thread];
-       i < optimize->thread_climbing[thread + 1]; ++i)
-    {
-      e = optimize_norm (i);
-      g_mutex_lock (mutex);
-      optimize_best_climbing (i, e);
-      optimize_save_variables (i, e);
-      if (e < optimize->threshold)
-        optimize->stop = 1;
-      g_mutex_unlock (mutex);
-      if (optimize->stop)
-        break;
+}
+
+/**
+ * Function to optimize with a sampling algorithm.
+ */
+static void
+optimize_sampling ()
+{
 #if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_climbing_thread: i=%u e=%lg\n", i, e);
+  fprintf (stderr, "optimize_sampling: start\n");
 #endif
-    }
+  optimize_sample (optimize->value);
+  optimize->nsaveds = 0;
+#if HAVE_MPI
+  if (optimize->dynamic)
+    optimize_dynamic ();
+  else
+#endif
+    optimize_parallel (optimize_merge, optimize->nbest, optimize->bound,
+                       optimize->nstart, optimize->nend,
+                       optimize->nthreads);
+  if (optimize->algorithm == ALGORITHM_SURROGATE)
+    optimize_surrogate_add ();
+
+  // Communicating tasks results
+  optimize_synchronise ();
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_climbing_thread: end\n");
+  fprintf (stderr, "optimize_sampling: end\n");
 #endif
-  g_thread_exit (NULL);
-  return NULL;
 }
 
 /**
  * Function to estimate a component of the hill climbing vector.
  */
 static double
-optimize_estimate_climbing_random (unsigned int variable,
+optimize_estimate_climbing_random (unsigned int climber,
+                                   ///< Climber number.
+                                   unsigned int variable,
                                    ///< Variable number.
                                    unsigned int estimate
                                    __attribute__((unused)))
   ///< Estimate number.
 {
   double x;
+  unsigned int k;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_estimate_climbing_random: start\n");
 #endif
-  x = optimize->climbing[variable]
-    + (1. - 2. * gsl_rng_uniform (optimize->rng)) * optimize->step[variable];
+  k = climber * optimize->nvariables + variable;
+  x = optimize->climbing[k]
+    + (1. - 2. * gsl_rng_uniform (optimize->rng)) * optimize->step[k];
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_estimate_climbing_random: climbing%u=%lg\n",
            variable, x);
@@ -973,22 +2713,26 @@ optimize_estimate_climbing_random (unsigned int variable,
  * Function to estimate a component of the hill climbing vector.
  */
 static double
-optimize_estimate_climbing_coordinates (unsigned int variable,
+optimize_estimate_climbing_coordinates (unsigned int climber,
+                                        ///< Climber number.
+                                        unsigned int variable,
                                         ///< Variable number.
                                         unsigned int estimate)
                                         ///< Estimate number.
 {
   double x;
+  unsigned int k;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_estimate_climbing_coordinates: start\n");
 #endif
-  x = optimize->climbing[variable];
+  k = climber * optimize->nvariables + variable;
+  x = optimize->climbing[k];
   if (estimate >= (2 * variable) && estimate < (2 * variable + 2))
     {
       if (estimate & 1)
-        x += optimize->step[variable];
+        x += optimize->step[k];
       else
-        x -= optimize->step[variable];
+        x -= optimize->step[k];
     }
 #if DEBUG_OPTIMIZE
   fprintf (stderr,
@@ -1000,201 +2744,558 @@ optimize_estimate_climbing_coordinates (unsigned int variable,
 }
 
 /**
- * Function to do a step of the hill climbing method.
+ * Function to do a step of the hill climbing method. The estimates of all the
+ *   climbers are calculated together in a single parallel pass.
  */
 static inline void
 optimize_step_climbing (unsigned int simulation)        ///< Simulation number.
 {
-  GThread *thread[nthreads_climbing];
-  ParallelData data[nthreads_climbing];
-  unsigned int i, j, k, b;
+  double bound;
+  unsigned int c, i, j, k, b, n;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_step_climbing: start\n");
 #endif
-  for (i = 0; i < optimize->nestimates; ++i)
+  bound = optimize->error_best[0];
+  for (c = 0; c < optimize->nclimbers; ++c)
     {
-      k = (simulation + i) * optimize->nvariables;
-      b = optimize->simulation_best[0] * optimize->nvariables;
-#if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_step_climbing: simulation=%u best=%u\n",
-               simulation + i, optimize->simulation_best[0]);
-#endif
-      for (j = 0; j < optimize->nvariables; ++j, ++k, ++b)
+      bound = fmax (bound, optimize->error_best[c]);
+      for (i = 0; i < optimize->nestimates; ++i)
         {
+          n = simulation + c * optimize->nestimates + i;
+          k = n * optimize->nvariables;
+          b = optimize->simulation_best[c] * optimize->nvariables;
 #if DEBUG_OPTIMIZE
           fprintf (stderr,
-                   "optimize_step_climbing: estimate=%u best%u=%.14le\n",
-                   i, j, optimize->value[b]);
+                   "optimize_step_climbing: simulation=%u climber=%u "
+                   "best=%u\n", n, c, optimize->simulation_best[c]);
 #endif
-          optimize->value[k]
-            = optimize->value[b] + optimize_estimate_climbing (j, i);
-          optimize->value[k] = fmin (fmax (optimize->value[k],
-                                           optimize->rangeminabs[j]),
-                                     optimize->rangemaxabs[j]);
+          for (j = 0; j < optimize->nvariables; ++j, ++k, ++b)
+            {
 #if DEBUG_OPTIMIZE
-          fprintf (stderr,
-                   "optimize_step_climbing: estimate=%u variable%u=%.14le\n",
-                   i, j, optimize->value[k]);
+              fprintf (stderr,
+                       "optimize_step_climbing: estimate=%u best%u=%.14le\n",
+                       i, j, optimize->value[b]);
 #endif
-        }
-    }
-  if (nthreads_climbing == 1)
-    optimize_climbing_sequential (simulation);
-  else
-    {
-      for (i = 0; i <= nthreads_climbing; ++i)
-        {
-          optimize->thread_climbing[i]
-            = simulation + optimize->nstart_climbing
-            + i * (optimize->nend_climbing - optimize->nstart_climbing)
-            / nthreads_climbing;
+              optimize->value[k]
+                = optimize->value[b] + optimize_estimate_climbing (c, j, i);
+              optimize->value[k] = fmin (fmax (optimize->value[k],
+                                               optimize->rangeminabs[j]),
+                                         optimize->rangemaxabs[j]);
 #if DEBUG_OPTIMIZE
-          fprintf (stderr,
-                   "optimize_step_climbing: i=%u thread_climbing=%u\n",
-                   i, optimize->thread_climbing[i]);
+              fprintf (stderr,
+                       "optimize_step_climbing: estimate=%u "
+                       "variable%u=%.14le\n", i, j, optimize->value[k]);
 #endif
+            }
         }
-      for (i = 0; i < nthreads_climbing; ++i)
-        {
-          data[i].thread = i;
-          thread[i] = g_thread_new
-            (NULL, (GThreadFunc) optimize_climbing_thread, &data[i]);
-        }
-      for (i = 0; i < nthreads_climbing; ++i)
-        g_thread_join (thread[i]);
     }
+  optimize->simulation_climbing = simulation;
+  n = (optimize->nclimbers > 1)
+    ? optimize->nclimbers * optimize->nestimates : 1;
+  optimize_parallel (optimize_merge_climbing, n, bound,
+                     simulation + optimize->nstart_climbing,
+                     simulation + optimize->nend_climbing,
+                     optimize->nthreads_climbing);
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_step_climbing: end\n");
 #endif
 }
 
 /**
- * Function to select the best simulation to start the hill climbing method.
+ * Function to sort an array of simulations in increasing order of the
+ *   objective function value.
+ */
+static inline void
+optimize_sort_best (unsigned int *simulation,
+                    ///< Array of simulation numbers.
+                    double *error,
+                    ///< Array of objective function values.
+                    unsigned int n)     ///< Number of simulations.
+{
+  double e;
+  unsigned int i, j, k;
+  for (i = 1; i < n; ++i)
+    {
+      k = simulation[i];
+      e = error[i];
+      for (j = i; j > 0 && error[j - 1] > e; --j)
+        {
+          simulation[j] = simulation[j - 1];
+          error[j] = error[j - 1];
+        }
+      simulation[j] = k;
+      error[j] = e;
+    }
+}
+
+/**
+ * Function to select the best simulations to start the hill climbing method.
  */
 static inline void
 optimize_climbing_best ()
 {
+  unsigned int i;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_climbing_best: start\n");
 #endif
-  optimize->simulation_best[0] = 0;
+  for (i = 0; i < optimize->nclimbers; ++i)
+    {
+      optimize->simulation_best[i] = i;
+      optimize->error_best[i] = optimize->error_old[i];
+    }
+  for (; i < optimize->nbest; ++i)
+    optimize->error_best[i] = INFINITY;
   memcpy (optimize->value, optimize->value_old,
-          optimize->nvariables * sizeof (double));
+          optimize->nclimbers * optimize->nvariables * sizeof (double));
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_climbing_best: end\n");
 #endif
 }
 
 /**
- * Function to optimize with a hill climbing method.
+ * Function to optimize with a hill climbing method. Every climber starts from
+ *   one of the best simulations and keeps its own climbing vector and step
+ *   sizes.
  */
 static inline void
 optimize_climbing (unsigned int nsteps) ///< Number of steps.
 {
-  unsigned int i, j, k, b, s, adjust;
+  unsigned int *b, *adjust;
+  unsigned int c, i, j, k, l, s, n;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_climbing: start\n");
 #endif
-  for (i = 0; i < optimize->nvariables; ++i)
+  b = optimize->climber_origin;
+  adjust = optimize->climber_adjust;
+  n = optimize->nclimbers * optimize->nvariables;
+  for (i = 0; i < n; ++i)
     optimize->climbing[i] = 0.;
-  b = optimize->simulation_best[0] * optimize->nvariables;
+  for (i = optimize->nvariables; i < n; ++i)
+    optimize->step[i] = optimize->step[i % optimize->nvariables];
+  for (c = 0; c < optimize->nclimbers; ++c)
+    {
+      b[c] = optimize->simulation_best[c] * optimize->nvariables;
+      adjust[c] = 1;
+    }
   s = optimize->nsimulations;
-  adjust = 1;
-  for (i = 0; i < nsteps; ++i, s += optimize->nestimates, b = k)
+  for (i = 0; i < nsteps; ++i, s += optimize->nclimbers * optimize->nestimates)
     {
 #if DEBUG_OPTIMIZE
       fprintf (stderr, "optimize_climbing: step=%u old_best=%u\n",
                i, optimize->simulation_best[0]);
 #endif
       optimize_step_climbing (s);
-      k = optimize->simulation_best[0] * optimize->nvariables;
+      for (c = 0; c < optimize->nclimbers; ++c)
+        {
+          k = optimize->simulation_best[c] * optimize->nvariables;
+          l = c * optimize->nvariables;
 #if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_climbing: step=%u best=%u\n",
-               i, optimize->simulation_best[0]);
+          fprintf (stderr, "optimize_climbing: step=%u climber=%u best=%u\n",
+                   i, c, optimize->simulation_best[c]);
 #endif
-      if (k == b)
-        {
-          if (adjust)
-            for (j = 0; j < optimize->nvariables; ++j)
-              optimize->step[j] *= 0.5;
-          for (j = 0; j < optimize->nvariables; ++j)
-            optimize->climbing[j] = 0.;
-          adjust = 1;
-        }
-      else
-        {
-          for (j = 0; j < optimize->nvariables; ++j)
+          if (k == b[c])
             {
+              if (adjust[c])
+                for (j = 0; j < optimize->nvariables; ++j)
+                  optimize->step[l + j] *= 0.5;
+              for (j = 0; j < optimize->nvariables; ++j)
+                optimize->climbing[l + j] = 0.;
+              adjust[c] = 1;
+            }
+          else
+            {
+              for (j = 0; j < optimize->nvariables; ++j)
+                {
 #if DEBUG_OPTIMIZE
-              fprintf (stderr,
-                       "optimize_climbing: best%u=%.14le old%u=%.14le\n",
-                       j, optimize->value[k + j], j, optimize->value[b + j]);
+                  fprintf (stderr,
+                           "optimize_climbing: best%u=%.14le old%u=%.14le\n",
+                           j, optimize->value[k + j], j,
+                           optimize->value[b[c] + j]);
 #endif
-              optimize->climbing[j]
-                = (1. - optimize->relaxation) * optimize->climbing[j]
-                + optimize->relaxation
-                * (optimize->value[k + j] - optimize->value[b + j]);
+                  optimize->climbing[l + j]
+                    = (1. - optimize->relaxation) * optimize->climbing[l + j]
+                    + optimize->relaxation
+                    * (optimize->value[k + j] - optimize->value[b[c] + j]);
 #if DEBUG_OPTIMIZE
-              fprintf (stderr, "optimize_climbing: climbing%u=%.14le\n",
-                       j, optimize->climbing[j]);
+                  fprintf (stderr, "optimize_climbing: climbing%u=%.14le\n",
+                           j, optimize->climbing[l + j]);
 #endif
+                }
+              adjust[c] = 0;
             }
-          adjust = 0;
+          b[c] = k;
         }
     }
+
+  // Sorting the climbers by increasing objective function value
+  optimize_sort_best (optimize->simulation_best, optimize->error_best,
+                      optimize->nclimbers);
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_climbing: end\n");
 #endif
 }
 
 /**
- * Function to calculate the objective function of an entity.
- *
- * \return objective function value.
+ * Function to merge the results of a thread in the simplex method, saving the
+ *   objective function values of the simulations of the step.
  */
-static double
-optimize_genetic_objective (Entity * entity)    ///< entity data.
+static void
+optimize_merge_simplex (unsigned int nsaveds,   ///< Number of saved results.
+                        unsigned int *simulation_best,
+                        ///< Array of best simulation numbers.
+                        double *error_best)
+                        ///< Array of best objective function values.
 {
+  unsigned int i;
+  for (i = 0; i < nsaveds; ++i)
+    optimize->error_simplex[simulation_best[i] - optimize->simulation_climbing]
+      = error_best[i];
+}
+
+/**
+ * Function to set the variables of a simulation of the simplex method on the
+ *   line joining an origin and a vertex, limited by the absolute ranges.
+ */
+static inline void
+optimize_simplex_point (unsigned int simulation,        ///< Simulation number.
+                        double *origin, ///< Array of origin variables.
+                        double *vertex, ///< Array of vertex variables.
+                        double factor)
+                        ///< Factor of the vertex to origin distance.
+{
+  double *x;
   unsigned int j;
-  double objective;
-  char buffer[64];
+  x = optimize->value + simulation * optimize->nvariables;
+  for (j = 0; j < optimize->nvariables; ++j)
+    x[j] = fmin (fmax (origin[j] + factor * (vertex[j] - origin[j]),
+                       optimize->rangeminabs[j]), optimize->rangemaxabs[j]);
+}
+
+/**
+ * Function to calculate the simulations of a step of the simplex method. The
+ *   objective function values of the step are gathered on all the tasks.
+ */
+static void
+optimize_simplex_step (unsigned int simulation,
+                       ///< First simulation number of the step.
+                       unsigned int n,  ///< Number of simulations.
+                       double bound)
+                       ///< Objective function value to prune the simulations.
+{
+  unsigned int i, nstart, nend;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_genetic_objective: start\n");
+  fprintf (stderr, "optimize_simplex_step: start\n");
+  fprintf (stderr, "optimize_simplex_step: simulation=%u n=%u bound=%.14le\n",
+           simulation, n, bound);
 #endif
-  for (j = 0; j < optimize->nvariables; ++j)
+  nstart = optimize->rank * n / ntasks;
+  nend = (1 + optimize->rank) * n / ntasks;
+  for (i = 0; i < n; ++i)
+    optimize->error_simplex[i] = (i >= nstart && i < nend) ? INFINITY
+      : -INFINITY;
+  optimize->simulation_climbing = simulation;
+  optimize_parallel (optimize_merge_simplex, n, bound, simulation + nstart,
+                     simulation + nend, optimize->nthreads_climbing);
+  optimize_gather (optimize->error_simplex, n);
+  for (i = 0; i < n; ++i)
+    if (optimize->error_simplex[i] == -INFINITY)
+      optimize->error_simplex[i] = INFINITY;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_simplex_step: end\n");
+#endif
+}
+
+/**
+ * Function to optimize with a parallel Nelder-Mead simplex method. Every
+ *   climber builds a simplex around its starting simulation with the step
+ *   sizes of the variables. In every step the worst vertices are reflected at
+ *   the same time through the centroid of the rest, calculating together the
+ *   reflected, expanded and contracted simulations of every vertex. If no
+ *   vertex is improved the simplex is shrunk towards its best vertex in the
+ *   next step.
+ */
+static void
+optimize_simplex (unsigned int nsteps)  ///< Number of steps.
+{
+  double *error, *origin, *centroid, *x, *f, *e, bound, threshold;
+  unsigned int *vertex, *state, *start, *v, c, i, j, k, n, nr, nvertices, w,
+    s, improved;
+  enum
+  { SIMPLEX_BUILD, SIMPLEX_REFLECT, SIMPLEX_SHRINK };
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_simplex: start\n");
+#endif
+  nvertices = optimize->nvariables + 1;
+  vertex = optimize->simplex_vertex;
+  state = optimize->simplex_state;
+  start = optimize->simplex_start;
+  error = optimize->error_vertex;
+  origin = optimize->simplex_origin;
+  centroid = optimize->simplex_centroid;
+
+  // Sharing the starting simulations of the master task
+  for (c = 0; c < optimize->nclimbers; ++c)
+    memcpy (origin + c * optimize->nvariables,
+            optimize->value
+            + optimize->simulation_best[c] * optimize->nvariables,
+            optimize->nvariables * sizeof (double));
+#if HAVE_MPI
+  MPI_Bcast (optimize->simulation_best, optimize->nclimbers, MPI_UNSIGNED, 0,
+             MPI_COMM_WORLD);
+  MPI_Bcast (optimize->error_best, optimize->nclimbers, MPI_DOUBLE, 0,
+             MPI_COMM_WORLD);
+  MPI_Bcast (origin, optimize->nclimbers * optimize->nvariables, MPI_DOUBLE,
+             0, MPI_COMM_WORLD);
+#else
+  if (!process_broadcast (optimize->simulation_best,
+                          optimize->nclimbers * sizeof (unsigned int))
+      || !process_broadcast (optimize->error_best,
+                             optimize->nclimbers * sizeof (double))
+      || !process_broadcast (origin, optimize->nclimbers
+                             * optimize->nvariables * sizeof (double)))
+    optimize->stop = 1;
+#endif
+  for (c = 0; c < optimize->nclimbers; ++c)
     {
-      optimize->value[entity->id * optimize->nvariables + j]
-        = genetic_get_variable (entity, optimize->genetic_variable + j);
+      memcpy (optimize->value
+              + optimize->simulation_best[c] * optimize->nvariables,
+              origin + c * optimize->nvariables,
+              optimize->nvariables * sizeof (double));
+      vertex[c * nvertices] = optimize->simulation_best[c];
+      error[c * nvertices] = optimize->error_best[c];
+      state[c] = SIMPLEX_BUILD;
     }
-  objective = optimize_norm (entity->id);
-  g_mutex_lock (mutex);
-  for (j = 0; j < optimize->nvariables; ++j)
+  nr = optimize->nreflections;
+  s = optimize->nsimulations;
+  for (i = 0; i < nsteps; ++i, s += n)
+    {
+
+      // Generating the simulations of the step of every climber
+      bound = -INFINITY;
+      for (c = n = 0; c < optimize->nclimbers; ++c)
+        {
+          start[c] = s + n;
+          v = vertex + c * nvertices;
+          e = error + c * nvertices;
+          x = optimize->value + v[0] * optimize->nvariables;
+          switch (state[c])
+            {
+            case SIMPLEX_BUILD:
+              for (j = 0; j < optimize->nvariables; ++j)
+                {
+                  k = (start[c] + j) * optimize->nvariables;
+                  memcpy (optimize->value + k, x,
+                          optimize->nvariables * sizeof (double));
+                  if (x[j] + optimize->step[j] > optimize->rangemaxabs[j])
+                    optimize->value[k + j] -= optimize->step[j];
+                  else
+                    optimize->value[k + j] += optimize->step[j];
+                }
+              n += optimize->nvariables;
+              bound = INFINITY;
+              break;
+            case SIMPLEX_SHRINK:
+              for (j = 0; j < optimize->nvariables; ++j)
+                optimize_simplex_point (start[c] + j, x,
+                                        optimize->value
+                                        + v[j + 1] * optimize->nvariables, 0.5);
+              n += optimize->nvariables;
+              bound = INFINITY;
+              break;
+            default:
+              for (j = 0; j < optimize->nvariables; ++j)
+                centroid[j] = 0.;
+              for (k = 0; k < nvertices - nr; ++k)
+                for (j = 0; j < optimize->nvariables; ++j)
+                  centroid[j]
+                    += optimize->value[v[k] * optimize->nvariables + j];
+              for (j = 0; j < optimize->nvariables; ++j)
+                centroid[j] /= nvertices - nr;
+              for (k = 0; k < nr; ++k)
+                {
+                  x = optimize->value
+                    + v[optimize->nvariables - k] * optimize->nvariables;
+                  optimize_simplex_point (start[c] + 3 * k, centroid, x, -1.);
+                  optimize_simplex_point (start[c] + 3 * k + 1, centroid, x,
+                                          -2.);
+                  optimize_simplex_point (start[c] + 3 * k + 2, centroid, x,
+                                          0.5);
+                }
+              n += 3 * nr;
+              bound = fmax (bound, e[optimize->nvariables]);
+            }
+        }
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_simplex: step=%u simulations=%u\n", i, n);
+#endif
+      optimize_simplex_step (s, n, bound);
+
+      // Updating the simplex of every climber
+      for (c = 0; c < optimize->nclimbers; ++c)
+        {
+          v = vertex + c * nvertices;
+          e = error + c * nvertices;
+          f = optimize->error_simplex + start[c] - s;
+          switch (state[c])
+            {
+            case SIMPLEX_BUILD:
+            case SIMPLEX_SHRINK:
+              for (j = 0; j < optimize->nvariables; ++j)
+                {
+                  v[j + 1] = start[c] + j;
+                  e[j + 1] = f[j];
+                }
+              state[c] = SIMPLEX_REFLECT;
+              break;
+            default:
+              threshold = e[nvertices - nr - 1];
+              for (k = improved = 0; k < nr; ++k, f += 3)
+                {
+                  w = optimize->nvariables - k;
+                  if (f[0] < e[0])
+                    j = (f[1] < f[0]) ? 1 : 0;
+                  else if (f[0] < threshold)
+                    j = 0;
+                  else if (f[2] < e[w])
+                    j = 2;
+                  else
+                    continue;
+                  v[w] = start[c] + 3 * k + j;
+                  e[w] = f[j];
+                  improved = 1;
+                }
+              if (!improved)
+                state[c] = SIMPLEX_SHRINK;
+            }
+          optimize_sort_best (v, e, nvertices);
+#if DEBUG_OPTIMIZE
+          fprintf (stderr,
+                   "optimize_simplex: step=%u climber=%u best=%u "
+                   "error=%.14le\n", i, c, v[0], e[0]);
+#endif
+        }
+    }
+  for (c = 0; c < optimize->nclimbers; ++c)
     {
-      snprintf (buffer, 64, "%s ", format[optimize->precision[j]]);
-      fprintf (optimize->file_variables, buffer,
-               genetic_get_variable (entity, optimize->genetic_variable + j));
+      optimize->simulation_best[c] = vertex[c * nvertices];
+      optimize->error_best[c] = error[c * nvertices];
     }
-  fprintf (optimize->file_variables, "%.14le\n", objective);
-  g_mutex_unlock (mutex);
+  optimize_sort_best (optimize->simulation_best, optimize->error_best,
+                      optimize->nclimbers);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_simplex: end\n");
+#endif
+}
+
+/**
+ * Function to merge the results of a thread in the evolutionary algorithms,
+ *   saving the objective function values of the simulations of the
+ *   generation.
+ */
+static void
+optimize_merge_generation (unsigned int nsaveds,
+                           ///< Number of saved results.
+                           unsigned int *simulation_best,
+                           ///< Array of best simulation numbers.
+                           double *error_best)
+                           ///< Array of best objective function values.
+{
+  unsigned int i;
+  for (i = 0; i < nsaveds; ++i)
+    optimize->error_generation[simulation_best[i]] = error_best[i];
+}
+
+/**
+ * Function to calculate the simulations of a generation of the evolutionary
+ *   algorithms. The simulations are distributed among the tasks and the
+ *   objective function values are gathered on all the tasks, so every task
+ *   evolves the same population. The pruned simulations get an infinite
+ *   objective function value.
+ */
+static void
+optimize_generation (unsigned int nsimulations,
+                     ///< Number of simulations of the generation.
+                     double bound)
+                     ///< Objective function value to prune the simulations.
+{
+  unsigned int i, nstart, nend;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_generation: start\n");
+#endif
+  nstart = optimize->rank * nsimulations / ntasks;
+  nend = (1 + optimize->rank) * nsimulations / ntasks;
+  for (i = 0; i < nsimulations; ++i)
+    optimize->error_generation[i] = (i >= nstart && i < nend) ? INFINITY
+      : -INFINITY;
+  optimize_parallel (optimize_merge_generation, nsimulations, bound, nstart,
+                     nend, optimize->nthreads);
+  optimize_gather (optimize->error_generation, nsimulations);
+  for (i = 0; i < nsimulations; ++i)
+    if (optimize->error_generation[i] == -INFINITY)
+      optimize->error_generation[i] = INFINITY;
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_genetic_objective: end\n");
+  fprintf (stderr, "optimize_generation: end\n");
 #endif
-  return objective;
 }
 
 /**
- * Function to optimize with the genetic algorithm.
+ * Function to invert a bit of a genome.
+ */
+static inline void
+optimize_genetic_flip (unsigned char *genome,   ///< Genome.
+                       unsigned int bit)        ///< Bit number.
+{
+  genome[bit >> 3] ^= (unsigned char) (1 << (bit & 7));
+}
+
+/**
+ * Function to decode the variables of a genome in a simulation. The bits of a
+ *   variable are saved from the most significant one, and the codes are
+ *   linearly mapped to the search range including its limits.
+ */
+static void
+optimize_genetic_decode (unsigned char *genome, ///< Genome.
+                         unsigned int simulation)       ///< Simulation number.
+{
+  GeneticVariable *variable;
+  double code;
+  unsigned int i, j, k;
+  for (i = 0; i < optimize->nvariables; ++i)
+    {
+      variable = optimize->genetic_variable + i;
+      for (j = 0, code = 0.; j < variable->nbits; ++j)
+        {
+          k = variable->location + j;
+          code = 2. * code + ((genome[k >> 3] >> (k & 7)) & 1);
+        }
+      optimize->value[simulation * optimize->nvariables + i]
+        = variable->minimum + code * (variable->maximum - variable->minimum)
+        / (ldexp (1., (int) variable->nbits) - 1.);
+    }
+}
+
+/**
+ * Function to optimize with the genetic algorithm. Every variable is encoded
+ *   in a fixed number of bits of the genome of the entities. On every
+ *   generation the worst entities are replaced by new entities produced from
+ *   random survivors by mutation (inverting a random bit), reproduction
+ *   (crossing the genomes of two survivors at a random bit) and adaptation
+ *   (inverting one of the least significant bits of a random variable, the
+ *   number of candidate bits decreasing with the generations). The new
+ *   entities are the first simulations of the generation and they are
+ *   calculated together, with the scheduling of the other algorithms.
  */
 static void
 optimize_genetic ()
 {
-  double *best_variable = NULL;
-  char *best_genome = NULL;
-  double best_objective = 0.;
+  unsigned char *genome, *survivor, *mother, *father, *child, *swap;
+  double *error, *error_survivor, e, error_best;
+  unsigned int *order, i, j, k, nbits, nbytes, nmutations, nreproductions,
+    nadaptations, nnew, nsurvivors, generation;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_genetic: start\n");
   fprintf (stderr, "optimize_genetic: ntasks=%u nthreads=%u\n", ntasks,
-           nthreads);
+           optimize->nthreads);
   fprintf (stderr,
            "optimize_genetic: nvariables=%u population=%u generations=%u\n",
            optimize->nvariables, optimize->nsimulations, optimize->niterations);
@@ -1203,31 +3304,371 @@ optimize_genetic ()
            optimize->mutation_ratio, optimize->reproduction_ratio,
            optimize->adaptation_ratio);
 #endif
-  genetic_algorithm_default (optimize->nvariables,
-                             optimize->genetic_variable,
-                             optimize->nsimulations,
-                             optimize->niterations,
-                             optimize->mutation_ratio,
-                             optimize->reproduction_ratio,
-                             optimize->adaptation_ratio,
-                             optimize->seed,
-                             optimize->threshold,
-                             &optimize_genetic_objective,
-                             &best_genome, &best_variable, &best_objective);
+
+  // Allocating the population
+  for (i = nbits = 0; i < optimize->nvariables; ++i)
+    {
+      optimize->genetic_variable[i].location = nbits;
+      nbits += optimize->genetic_variable[i].nbits;
+    }
+  nbytes = (nbits + 7) / 8;
+  genome = (unsigned char *) g_malloc (optimize->nsimulations * nbytes);
+  survivor = (unsigned char *) g_malloc (optimize->nsimulations * nbytes);
+  optimize->error_generation
+    = (double *) g_malloc (optimize->nsimulations * sizeof (double));
+  error_survivor
+    = (double *) g_malloc (optimize->nsimulations * sizeof (double));
+  order = (unsigned int *)
+    g_malloc (optimize->nsimulations * sizeof (unsigned int));
+  error = optimize->error_generation;
+  optimize->error_old = (double *) g_malloc (sizeof (double));
+  optimize->value_old
+    = (double *) g_malloc (optimize->nvariables * sizeof (double));
+  nmutations = (unsigned int) (optimize->mutation_ratio
+                               * optimize->nsimulations);
+  nreproductions = (unsigned int) (optimize->reproduction_ratio
+                                   * optimize->nsimulations);
+  nadaptations = (unsigned int) (optimize->adaptation_ratio
+                                 * optimize->nsimulations);
+  nnew = nmutations + nreproductions + nadaptations;
+  nsurvivors = optimize->nsimulations - nnew;
+
+  // Calculating a random initial population
+  for (i = 0; i < optimize->nsimulations * nbytes; ++i)
+    genome[i] = (unsigned char) gsl_rng_uniform_int (optimize->rng, 256);
+  for (i = 0; i < optimize->nsimulations; ++i)
+    optimize_genetic_decode (genome + i * nbytes, i);
+  optimize_generation (optimize->nsimulations, INFINITY);
+  error_best = INFINITY;
+  for (generation = 1;; ++generation)
+    {
+      g_async_queue_push (optimize->queue_variables,
+                          optimize_variables_iteration);
+      if (optimize->prune)
+        optimize_order ();
+
+      // Ranking the entities
+      for (i = 0; i < optimize->nsimulations; ++i)
+        {
+          e = error[i];
+          for (j = i; j > 0 && error[order[j - 1]] > e; --j)
+            order[j] = order[j - 1];
+          order[j] = i;
+        }
+      if (error[order[0]] < error_best)
+        {
+          error_best = error[order[0]];
+          memcpy (optimize->value_old,
+                  optimize->value + order[0] * optimize->nvariables,
+                  optimize->nvariables * sizeof (double));
+        }
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_genetic: generation=%u best=%.14le\n",
+               generation, error_best);
+#endif
+      if (error_best < optimize->threshold)
+        optimize->stop = 1;
+      if (optimize->stop || generation == optimize->niterations)
+        break;
+
+      // Saving the survivors after the new entities
+      for (i = 0; i < nsurvivors; ++i)
+        {
+          memcpy (survivor + (nnew + i) * nbytes, genome + order[i] * nbytes,
+                  nbytes);
+          error_survivor[nnew + i] = error[order[i]];
+        }
+
+      // Producing the new entities
+      for (i = 0; i < nnew; ++i)
+        {
+          child = survivor + i * nbytes;
+          mother = survivor + (nnew + gsl_rng_uniform_int (optimize->rng,
+                                                           nsurvivors))
+            * nbytes;
+          memcpy (child, mother, nbytes);
+          if (i < nmutations)
+            optimize_genetic_flip (child,
+                                   gsl_rng_uniform_int (optimize->rng,
+                                                        nbits));
+          else if (i < nmutations + nreproductions)
+            {
+              do
+                father = survivor + (nnew + gsl_rng_uniform_int
+                                     (optimize->rng, nsurvivors)) * nbytes;
+              while (father == mother);
+              k = gsl_rng_uniform_int (optimize->rng, nbits);
+              for (j = k; j < nbits; ++j)
+                if ((child[j >> 3] ^ father[j >> 3]) & (1 << (j & 7)))
+                  optimize_genetic_flip (child, j);
+            }
+          else
+            {
+              j = gsl_rng_uniform_int (optimize->rng, optimize->nvariables);
+              k = optimize->genetic_variable[j].nbits
+                * (optimize->niterations - generation)
+                / optimize->niterations;
+              k = JBM_MAX (k, 1);
+              optimize_genetic_flip (child,
+                                     optimize->genetic_variable[j].location
+                                     + optimize->genetic_variable[j].nbits - 1
+                                     - gsl_rng_uniform_int (optimize->rng, k));
+            }
+        }
+      swap = genome;
+      genome = survivor;
+      survivor = swap;
+      memcpy (error + nnew, error_survivor + nnew,
+              nsurvivors * sizeof (double));
+
+      // Calculating the new entities, a new entity worse than all the
+      // survivors can not survive the next generation
+      for (i = 0; i < optimize->nsimulations; ++i)
+        optimize_genetic_decode (genome + i * nbytes, i);
+      optimize_generation (nnew, optimize->prune
+                           ? error[optimize->nsimulations - 1] : INFINITY);
+    }
+
+  // Saving the best entity
+  optimize->error_old[0] = error_best;
+  g_free (order);
+  g_free (error_survivor);
+  g_free (optimize->error_generation);
+  optimize->error_generation = NULL;
+  g_free (survivor);
+  g_free (genome);
+  optimize_print ();
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_genetic: end\n");
+#endif
+}
+
+/**
+ * Function to optimize with the CMA-ES (covariance matrix adaptation
+ *   evolution strategy) algorithm. The variables are scaled to the search
+ *   ranges and the samples are limited to the absolute ranges, updating the
+ *   distribution with the limited samples. The covariance matrix is factorized
+ *   by the Cholesky method. A run finishes after the generations number or
+ *   when the distribution collapses, and the IPOP restarts begin new runs from
+ *   a random mean doubling the population.
+ */
+static void
+optimize_cmaes ()
+{
+  double *mean, *scale, *lower, *upper, *pc, *ps, *yw, *zw, *z, *value_best,
+    *x, *y, *C, *A, *weight, *error, sigma, mueff, cc, cs, c1, cmu, damps,
+    chin, hsig, d, e, error_best;
+  unsigned int *order, i, j, k, l, n, lambda, mu, restart, generation;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_cmaes: start\n");
+#endif
+  n = optimize->nvariables;
+  mean = (double *) g_malloc (10 * n * sizeof (double));
+  scale = mean + n;
+  lower = scale + n;
+  upper = lower + n;
+  pc = upper + n;
+  ps = pc + n;
+  yw = ps + n;
+  zw = yw + n;
+  z = zw + n;
+  value_best = z + n;
+  optimize->error_generation
+    = (double *) g_malloc (optimize->nsimulations * sizeof (double));
+  y = (double *) g_malloc (optimize->nsimulations * n * sizeof (double));
+  C = (double *) g_malloc (n * n * sizeof (double));
+  A = (double *) g_malloc (n * n * sizeof (double));
+  weight = (double *) g_malloc (optimize->nsimulations * sizeof (double));
+  order = (unsigned int *)
+    g_malloc (optimize->nsimulations * sizeof (unsigned int));
+  error = optimize->error_generation;
+  for (j = 0; j < n; ++j)
+    {
+      scale[j] = optimize->rangemax[j] - optimize->rangemin[j];
+      if (!(scale[j] > 0.))
+        scale[j] = 1.;
+      value_best[j] = optimize->rangemin[j] + 0.5 * scale[j];
+      lower[j] = (optimize->rangeminabs[j] - optimize->rangemin[j]) / scale[j];
+      upper[j] = (optimize->rangemaxabs[j] - optimize->rangemin[j]) / scale[j];
+    }
+  chin = sqrt (n) * (1. - 1. / (4. * n) + 1. / (21. * n * n));
+  error_best = INFINITY;
+  lambda = optimize->nsimulations >> optimize->nrestarts;
+  for (restart = 0; restart <= optimize->nrestarts && !optimize->stop;
+       ++restart, lambda *= 2)
+    {
+
+      // Initing the parameters of the run
+      mu = lambda / 2;
+      for (i = 0, d = 0.; i < mu; ++i)
+        {
+          weight[i] = log (mu + 0.5) - log (i + 1.);
+          d += weight[i];
+        }
+      for (i = 0, e = 0.; i < mu; ++i)
+        {
+          weight[i] /= d;
+          e += weight[i] * weight[i];
+        }
+      mueff = 1. / e;
+      cc = (4. + mueff / n) / (n + 4. + 2. * mueff / n);
+      cs = (mueff + 2.) / (n + mueff + 5.);
+      c1 = 2. / ((n + 1.3) * (n + 1.3) + mueff);
+      cmu = fmin (1. - c1, 2. * (mueff - 2. + 1. / mueff)
+                  / ((n + 2.) * (n + 2.) + mueff));
+      damps = 1. + 2. * fmax (0., sqrt ((mueff - 1.) / (n + 1.)) - 1.) + cs;
+#if DEBUG_OPTIMIZE
+      fprintf (stderr, "optimize_cmaes: restart=%u lambda=%u mu=%u\n",
+               restart, lambda, mu);
+#endif
+
+      // Initing the distribution, centered on the search ranges at the first
+      // run and on a random point on the restarts
+      sigma = DEFAULT_CMAES_SIGMA;
+      for (j = 0; j < n; ++j)
+        {
+          mean[j] = restart ? gsl_rng_uniform (optimize->rng) : 0.5;
+          pc[j] = ps[j] = 0.;
+          for (k = 0; k < n; ++k)
+            C[j * n + k] = (j == k) ? 1. : 0.;
+        }
+
+      for (generation = 0; generation < optimize->niterations; ++generation)
+        {
+
+          // Factorizing the covariance matrix by the Cholesky method
+          for (j = 0; j < n; ++j)
+            for (k = 0; k <= j; ++k)
+              {
+                e = C[j * n + k];
+                for (l = 0; l < k; ++l)
+                  e -= A[j * n + l] * A[k * n + l];
+                if (j == k)
+                  A[j * n + j] = sqrt (fmax (e, DBL_EPSILON));
+                else
+                  A[j * n + k] = e / A[k * n + k];
+              }
+
+          // Sampling the generation, limited by the absolute ranges
+          for (i = 0; i < lambda; ++i)
+            {
+              x = optimize->value + i * n;
+              for (j = 0; j < n; ++j)
+                z[j] = gsl_ran_ugaussian (optimize->rng);
+              for (j = 0; j < n; ++j)
+                {
+                  for (k = 0, d = 0.; k <= j; ++k)
+                    d += A[j * n + k] * z[k];
+                  e = fmin (fmax (mean[j] + sigma * d, lower[j]), upper[j]);
+                  y[i * n + j] = (e - mean[j]) / sigma;
+                  x[j] = optimize->rangemin[j] + e * scale[j];
+                }
+            }
+          optimize_generation (lambda, INFINITY);
+          g_async_queue_push (optimize->queue_variables,
+                              optimize_variables_iteration);
+
+          // Ranking the simulations
+          for (i = 0; i < lambda; ++i)
+            {
+              e = error[i];
+              for (j = i; j > 0 && error[order[j - 1]] > e; --j)
+                order[j] = order[j - 1];
+              order[j] = i;
+            }
+          if (error[order[0]] < error_best)
+            {
+              error_best = error[order[0]];
+              memcpy (value_best, optimize->value + order[0] * n,
+                      n * sizeof (double));
+            }
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_genetic: the best\n");
+          fprintf (stderr,
+                   "optimize_cmaes: generation=%u sigma=%.14le "
+                   "error=%.14le best=%.14le\n",
+                   generation, sigma, error[order[0]], error_best);
 #endif
+          if (error_best < optimize->threshold)
+            optimize->stop = 1;
+          if (optimize->stop)
+            break;
+
+          // Recombining the best simulations to move the mean
+          for (j = 0; j < n; ++j)
+            {
+              for (i = 0, d = 0.; i < mu; ++i)
+                d += weight[i] * y[order[i] * n + j];
+              yw[j] = d;
+              mean[j] += sigma * d;
+            }
+
+          // Updating the evolution paths
+          for (j = 0; j < n; ++j)
+            {
+              for (k = 0, d = yw[j]; k < j; ++k)
+                d -= A[j * n + k] * zw[k];
+              zw[j] = d / A[j * n + j];
+            }
+          d = sqrt (cs * (2. - cs) * mueff);
+          for (j = 0, e = 0.; j < n; ++j)
+            {
+              ps[j] = (1. - cs) * ps[j] + d * zw[j];
+              e += ps[j] * ps[j];
+            }
+          e = sqrt (e);
+          hsig = (e / sqrt (1. - pow (1. - cs, 2. * (generation + 1.))) / chin
+                  < 1.4 + 2. / (n + 1.)) ? 1. : 0.;
+          d = hsig * sqrt (cc * (2. - cc) * mueff);
+          for (j = 0; j < n; ++j)
+            pc[j] = (1. - cc) * pc[j] + d * yw[j];
+
+          // Adapting the covariance matrix and the step size
+          for (j = 0; j < n; ++j)
+            for (k = 0; k <= j; ++k)
+              {
+                for (i = 0, d = 0.; i < mu; ++i)
+                  d += weight[i] * y[order[i] * n + j] * y[order[i] * n + k];
+                C[j * n + k] = C[k * n + j]
+                  = (1. - c1 - cmu) * C[j * n + k]
+                  + c1 * (pc[j] * pc[k]
+                          + (1. - hsig) * cc * (2. - cc) * C[j * n + k])
+                  + cmu * d;
+              }
+          sigma *= exp (fmin (1., cs / damps * (e / chin - 1.)));
+
+          // Enlarging the step size up to the search ranges on a flat
+          // objective function, else checking the collapse of the distribution
+          if (error[order[0]] == error[order[(7 * lambda + 9) / 10 - 1]])
+            {
+              if (sigma < 1.)
+                sigma = fmin (sigma * exp (0.2 + cs / damps), 1.);
+              continue;
+            }
+          for (j = 0, d = 0.; j < n; ++j)
+            d = fmax (d, C[j * n + j]);
+          if (sigma * sqrt (d) < DEFAULT_CMAES_TOLERANCE
+              || !(error[order[lambda - 1]] - error[order[0]]
+                   > DEFAULT_CMAES_TOLERANCE * fabs (error[order[0]])))
+            break;
+        }
+    }
+
+  // Saving the best simulation
   optimize->error_old = (double *) g_malloc (sizeof (double));
-  optimize->value_old
-    = (double *) g_malloc (optimize->nvariables * sizeof (double));
-  optimize->error_old[0] = best_objective;
-  memcpy (optimize->value_old, best_variable,
-          optimize->nvariables * sizeof (double));
-  g_free (best_genome);
-  g_free (best_variable);
+  optimize->value_old = (double *) g_malloc (n * sizeof (double));
+  optimize->error_old[0] = error_best;
+  memcpy (optimize->value_old, value_best, n * sizeof (double));
+  g_free (order);
+  g_free (weight);
+  g_free (A);
+  g_free (C);
+  g_free (y);
+  g_free (mean);
+  g_free (optimize->error_generation);
+  optimize->error_generation = NULL;
   optimize_print ();
 #if DEBUG_OPTIMIZE
-  fprintf (stderr, "optimize_genetic: end\n");
+  fprintf (stderr, "optimize_cmaes: end\n");
 #endif
 }
 
@@ -1270,11 +3711,12 @@ static inline void
 optimize_merge_old ()
 {
   unsigned int i, j, k;
-  double v[optimize->nbest * optimize->nvariables], e[optimize->nbest],
-    *enew, *eold;
+  double *v, *e, *enew, *eold;
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_merge_old: start\n");
 #endif
+  v = optimize->value_merge;
+  e = optimize->error_merge;
   enew = optimize->error_best;
   eold = optimize->error_old;
   i = j = k = 0;
@@ -1312,23 +3754,23 @@ optimize_merge_old ()
 
 /**
  * Function to refine the search ranges of the variables in iterative 
- * algorithms.
+ * algorithms. On pruning, the objective function value of the worst best
+ * simulation is the bound of the next iteration, as a worse simulation can not
+ * enter the best set. The hill climbing steps start from the best simulations
+ * of every sampling, so they are not pruned.
  */
 static inline void
 optimize_refine ()
 {
   unsigned int i, j;
   double d;
-#if HAVE_MPI
-  MPI_Status mpi_stat;
-#endif
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_refine: start\n");
 #endif
-#if HAVE_MPI
-  if (!optimize->mpi_rank)
+  if (!optimize->rank)
     {
-#endif
+      if (optimize->prune && !optimize->nsteps)
+        optimize->bound = optimize->error_old[optimize->nbest - 1];
       for (j = 0; j < optimize->nvariables; ++j)
         {
           optimize->rangemin[j] = optimize->rangemax[j]
@@ -1354,6 +3796,9 @@ optimize_refine ()
           switch (optimize->algorithm)
             {
             case ALGORITHM_MONTE_CARLO:
+            case ALGORITHM_SURROGATE:
+            case ALGORITHM_SOBOL:
+            case ALGORITHM_LATIN:
               d *= 0.5;
               break;
             default:
@@ -1374,22 +3819,20 @@ optimize_refine ()
                    optimize->label[j], optimize->rangemin[j],
                    optimize->rangemax[j]);
         }
-#if HAVE_MPI
-      for (i = 1; (int) i < ntasks; ++i)
-        {
-          MPI_Send (optimize->rangemin, optimize->nvariables, MPI_DOUBLE, i,
-                    1, MPI_COMM_WORLD);
-          MPI_Send (optimize->rangemax, optimize->nvariables, MPI_DOUBLE, i,
-                    1, MPI_COMM_WORLD);
-        }
-    }
-  else
-    {
-      MPI_Recv (optimize->rangemin, optimize->nvariables, MPI_DOUBLE, 0, 1,
-                MPI_COMM_WORLD, &mpi_stat);
-      MPI_Recv (optimize->rangemax, optimize->nvariables, MPI_DOUBLE, 0, 1,
-                MPI_COMM_WORLD, &mpi_stat);
     }
+#if HAVE_MPI
+  MPI_Bcast (optimize->rangemin, optimize->nvariables, MPI_DOUBLE, 0,
+             MPI_COMM_WORLD);
+  MPI_Bcast (optimize->rangemax, optimize->nvariables, MPI_DOUBLE, 0,
+             MPI_COMM_WORLD);
+  MPI_Bcast (&optimize->bound, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+#else
+  if (!process_broadcast (optimize->rangemin,
+                          optimize->nvariables * sizeof (double))
+      || !process_broadcast (optimize->rangemax,
+                             optimize->nvariables * sizeof (double))
+      || !process_broadcast (&optimize->bound, sizeof (double)))
+    optimize->stop = 1;
 #endif
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_refine: end\n");
@@ -1407,12 +3850,76 @@ optimize_step ()
 #endif
   optimize_algorithm ();
   if (optimize->nsteps)
-    optimize_climbing (optimize->nsteps);
+    optimize_climbing_method (optimize->nsteps);
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_step: end\n");
 #endif
 }
 
+/**
+ * Function to iterate a sampling algorithm with pipelined iterations. The
+ *   search ranges of an iteration are refined from the simulations finished
+ *   once a fraction of the previous iteration is complete, and its simulations
+ *   start while the remaining simulations of the previous iteration finish on
+ *   other threads. The passes alternate between two sets of rows, and the
+ *   results of the finished simulations are merged in the best results on
+ *   every iteration, including the late simulations of the previous ones,
+ *   which are merged before sampling again the rows of their pass.
+ */
+static void
+optimize_pipeline ()
+{
+  gint64 t;
+  unsigned int i, n, pass;
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_pipeline: start\n");
+#endif
+  n = (unsigned int) ceil (optimize->pipeline * optimize->nsimulations);
+  n = JBM_MIN (JBM_MAX (n, optimize->nbest), optimize->nsimulations);
+  t = g_get_monotonic_time ();
+  for (i = 0; i < optimize->niterations && !optimize->stop; ++i)
+    {
+      pass = i % NPASSES;
+      optimize_pipeline_wait (pass, 0);
+
+      // Merging the late simulations before overwriting the rows of the pass
+      if (i)
+        {
+          optimize_pipeline_collect ();
+          optimize_merge_old ();
+        }
+      optimize_sample (optimize->value
+                       + pass * optimize->nrows * optimize->nvariables);
+      optimize_pipeline_start (pass, pass * optimize->nrows,
+                               pass * optimize->nrows + optimize->nsimulations,
+                               optimize->bound);
+      optimize_pipeline_wait (pass, n);
+      optimize_pipeline_collect ();
+      g_async_queue_push (optimize->queue_variables,
+                          optimize_variables_iteration);
+      if (i)
+        optimize_merge_old ();
+      else
+        optimize_save_old ();
+      optimize_refine ();
+      optimize_print ();
+    }
+
+  // Merging the simulations finished after the last iteration
+  for (pass = 0; pass < NPASSES; ++pass)
+    optimize_pipeline_wait (pass, 0);
+  optimize_pipeline_collect ();
+  optimize_merge_old ();
+  optimize_print ();
+  t = g_get_monotonic_time () - t;
+  for (i = 0; i < optimize->nworkers; ++i)
+    optimize->time_idle[i]
+      = fmax (0., 0.000001 * t - optimize->time_busy[i]);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_pipeline: end\n");
+#endif
+}
+
 /**
  * Function to iterate the algorithm.
  */
@@ -1427,21 +3934,38 @@ optimize_iterate ()
   optimize->value_old =
     (double *) g_malloc (optimize->nbest * optimize->nvariables *
                          sizeof (double));
-  optimize_step ();
-  optimize_save_old ();
-  optimize_refine ();
-  optimize_print ();
-  for (i = 1; i < optimize->niterations && !optimize->stop; ++i)
+  optimize->value_merge =
+    (double *) g_malloc (optimize->nbest * optimize->nvariables *
+                         sizeof (double));
+  optimize->bound = INFINITY;
+  if (optimize->pipelined)
+    optimize_pipeline ();
+  else
     {
       optimize_step ();
-      optimize_merge_old ();
+      g_async_queue_push (optimize->queue_variables,
+                          optimize_variables_iteration);
+      if (optimize->prune)
+        optimize_order ();
+      optimize_save_old ();
       optimize_refine ();
       optimize_print ();
+      for (i = 1; i < optimize->niterations && !optimize->stop; ++i)
+        {
+          optimize_step ();
+          g_async_queue_push (optimize->queue_variables,
+                              optimize_variables_iteration);
+          if (optimize->prune)
+            optimize_order ();
+          optimize_merge_old ();
+          optimize_refine ();
+          optimize_print ();
+        }
     }
   if (optimize->nfinal_steps && !optimize->stop)
     {
       optimize_climbing_best ();
-      optimize_climbing (optimize->nfinal_steps);
+      optimize_climbing_method (optimize->nfinal_steps);
       optimize_merge_old ();
       optimize_print ();
     }
@@ -1458,7 +3982,6 @@ optimize_save_optimal ()
 {
   char cinput[32];
   unsigned int i, j;
-  unsigned int flags = 1;
 
   // Getting optimal values
   memcpy (optimize->value, optimize->value_old,
@@ -1474,9 +3997,10 @@ optimize_save_optimal ()
                  i, j, cinput);
 #endif
         // Checking templates
-        if (optimize->template_flags & flags)
-          optimize_input (0, cinput, optimize->file[i][j]);
-        flags <<= 1;
+        if ((optimize->template_flags & (1u << i))
+            && !optimize_input (0, cinput, i, j))
+          fprintf (stderr, "%s: %s\n", _("Unable to write the input"),
+                   cinput);
       }
 }
 
@@ -1493,26 +4017,402 @@ optimize_free ()
   for (j = 0; j < optimize->ninputs; ++j)
     {
       for (i = 0; i < optimize->nexperiments; ++i)
-        g_mapped_file_unref (optimize->file[j][i]);
+        {
+          template_free (optimize->template[j] + i);
+          if (optimize->file[j][i])
+            g_mapped_file_unref (optimize->file[j][i]);
+        }
+      g_free (optimize->template[j]);
       g_free (optimize->file[j]);
     }
+  optimize->ninputs = 0;
   g_free (optimize->error_old);
   g_free (optimize->value_old);
   g_free (optimize->value);
+  g_free (optimize->error_experiment);
+  g_free (optimize->nexperiments_left);
+  g_free (optimize->pruned);
+  g_free (optimize->sobol_point);
+  g_free (optimize->range);
   g_free (optimize->genetic_variable);
+  g_free (optimize->time_idle);
+  g_free (optimize->time_busy);
+  g_free (optimize->experiment_order);
+  g_free (optimize->experiment_score);
+  g_free (optimize->experiment_calculations);
+  g_free (optimize->experiment_count);
+  g_free (optimize->experiment_sum2);
+  g_free (optimize->experiment_sum);
+  g_free (optimize->experiment_time);
+  g_free (optimize->pipeline_best->error_best);
+  g_free (optimize->pipeline_best->simulation_best);
+  g_free (optimize->pipeline_data);
+  g_free (optimize->parallel_data);
+  g_free (optimize->error_heap);
+  g_free (optimize->simulation_heap);
+  g_free (optimize->simplex_centroid);
+  g_free (optimize->simplex_origin);
+  g_free (optimize->error_simplex);
+  g_free (optimize->error_vertex);
+  g_free (optimize->simplex_vertex);
+  g_free (optimize->simplex_start);
+  g_free (optimize->simplex_state);
+  g_free (optimize->climber_adjust);
+  g_free (optimize->climber_origin);
+  g_free (optimize->value_merge);
+  g_free (optimize->error_merge);
+  g_free (optimize->simulation_merge);
+  g_free (optimize->best_merged);
+  g_free (optimize->best_task);
+  g_free (optimize->error_best);
+  g_free (optimize->simulation_best);
+  g_free (optimize->candidate_improvement);
+  g_free (optimize->candidate_value);
+  g_free (optimize->surrogate_scale);
+  g_free (optimize->surrogate_error);
+  g_free (optimize->surrogate_value);
+  optimize->error_old = optimize->value_old = optimize->value = NULL;
+  optimize->error_experiment = NULL;
+  optimize->nexperiments_left = NULL;
+  optimize->pruned = NULL;
+  optimize->range = optimize->sobol_point = NULL;
+  optimize->time_idle = optimize->time_busy = NULL;
+  optimize->experiment_sum2 = optimize->experiment_sum
+    = optimize->experiment_time = NULL;
+  optimize->experiment_score = NULL;
+  optimize->experiment_order = optimize->experiment_calculations
+    = optimize->experiment_count = NULL;
+  optimize->error_heap = optimize->value_merge = optimize->error_merge = NULL;
+  optimize->error_best = NULL;
+  optimize->best_task = optimize->best_merged = NULL;
+  optimize->simulation_heap = optimize->simulation_merge = NULL;
+  optimize->climber_origin = optimize->climber_adjust = NULL;
+  optimize->simplex_vertex = optimize->simplex_state = optimize->simplex_start
+    = NULL;
+  optimize->error_vertex = optimize->error_simplex = optimize->simplex_origin
+    = optimize->simplex_centroid = NULL;
+  optimize->pipeline_best->error_best = NULL;
+  optimize->pipeline_best->simulation_best = NULL;
+  optimize->pipeline_data = optimize->parallel_data = NULL;
+  optimize->simulation_best = NULL;
+  optimize->genetic_variable = NULL;
+  optimize->surrogate_value = optimize->surrogate_error
+    = optimize->surrogate_scale = optimize->candidate_value
+    = optimize->candidate_improvement = NULL;
+  g_free (optimize->cleaner);
+  g_free (optimize->evaluator);
+  g_free (optimize->simulator);
+  optimize->cleaner = optimize->evaluator = optimize->simulator = NULL;
+  if (optimize_module)
+    {
+      g_module_close (optimize_module);
+      optimize_module = NULL;
+    }
+  if (optimize->server)
+    {
+      for (i = 0; i < optimize->nservers; ++i)
+        optimize_server_close (optimize->server + i);
+      g_async_queue_unref (optimize->queue_server);
+      g_free (optimize->server);
+      optimize->server = NULL;
+    }
+  if (optimize->database)
+    {
+      database_close (optimize->database);
+      g_free (optimize->database);
+      optimize->database = NULL;
+    }
+  if (optimize->cache)
+    {
+      for (i = 0; i < NCACHES; ++i)
+        {
+          g_hash_table_destroy (optimize->cache[i].table);
+          g_mutex_clear (optimize->cache[i].mutex);
+        }
+      g_free (optimize->cache);
+      optimize->cache = NULL;
+    }
+#if !HAVE_MPI
+  if (optimize->rank)
+    {
+      g_free (optimize->variables);
+      g_free (optimize->result);
+      optimize->result = optimize->variables = NULL;
+    }
+#endif
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_free: end\n");
 #endif
 }
 
+/**
+ * Function to build the path of a program to run it without a shell.
+ *
+ * \return program path or NULL if no program.
+ */
+static char *
+optimize_program (char *name)   ///< Program name.
+{
+  char *buffer, *buffer2, *path;
+  if (!name)
+    return NULL;
+  buffer = g_path_get_dirname (name);
+  buffer2 = g_path_get_basename (name);
+  path = g_build_filename (buffer, buffer2, NULL);
+  g_free (buffer2);
+  g_free (buffer);
+  return path;
+}
+
+/**
+ * Function to load the simulator plugin.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+optimize_plugin_open (char *name)       ///< Plugin file name.
+{
+  char *path, *buffer;
+
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_plugin_open: start\n");
+#endif
+
+  // Opening the module
+  path = optimize_program (name);
+  optimize_module = g_module_open (path, G_MODULE_BIND_LAZY
+                                   | G_MODULE_BIND_LOCAL);
+  g_free (path);
+  if (!optimize_module)
+    {
+      buffer = g_strconcat (_("Bad simulator plugin"), ":\n",
+                            g_module_error (), NULL);
+      goto exit_on_error;
+    }
+
+  // Getting the objective function
+  optimize_plugin_variables = NULL;
+  optimize_plugin_inputs = NULL;
+  if (!g_module_symbol (optimize_module, PLUGIN_VARIABLES,
+                        (gpointer *) & optimize_plugin_variables)
+      && !g_module_symbol (optimize_module, PLUGIN_INPUTS,
+                           (gpointer *) & optimize_plugin_inputs))
+    {
+      buffer = g_strconcat (_("Bad simulator plugin"), ":\n",
+                            _("No objective function"), " (",
+                            PLUGIN_VARIABLES, ", ", PLUGIN_INPUTS, ")", NULL);
+      g_module_close (optimize_module);
+      optimize_module = NULL;
+      goto exit_on_error;
+    }
+
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_plugin_open: end\n");
+#endif
+  return 1;
+
+exit_on_error:
+  jb_show_error (buffer);
+  g_free (buffer);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_plugin_open: end\n");
+#endif
+  return 0;
+}
+
+/**
+ * Function to launch the persistent simulator processes, one for every thread.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+optimize_server_start ()
+{
+  char *buffer;
+  unsigned int i;
+
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_server_start: start\n");
+#endif
+#ifndef G_OS_WIN32
+  // Writing to a finished server has to return an error instead of a signal
+  signal (SIGPIPE, SIG_IGN);
+#endif
+  optimize->nservers
+    = JBM_MAX (optimize->nthreads, optimize->nthreads_climbing);
+  optimize->server
+    = (Server *) g_malloc (optimize->nservers * sizeof (Server));
+  optimize->queue_server = g_async_queue_new ();
+  for (i = 0; i < optimize->nservers; ++i)
+    {
+      if (!optimize_server_open (optimize->server + i))
+        {
+          optimize->nservers = i;
+          buffer = g_strconcat (_("Unable to launch the simulator server"),
+                                ":\n", optimize->simulator, NULL);
+          jb_show_error (buffer);
+          g_free (buffer);
+          return 0;
+        }
+      g_async_queue_push (optimize->queue_server, optimize->server + i);
+    }
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_server_start: end\n");
+#endif
+  return 1;
+}
+
+/**
+ * Function to wait for the connections of the worker daemons. Every daemon
+ *   opens a connection for each of its slots, greeting with a line with the
+ *   number of slots and the slot number. The threads numbers of the
+ *   optimization are set to the number of slots. The daemons are waited at
+ *   most input->timeout seconds.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+optimize_remote_start ()
+{
+#ifdef G_OS_WIN32
+  jb_show_error (_("Worker daemons are not supported on this platform"));
+  return 0;
+#else
+  struct addrinfo hints, *address, *a;
+  struct pollfd pfd[1];
+  char buffer[64];
+  Server *server;
+  gint64 t = 0;
+  unsigned int nworkers, nexpected, slots, slot;
+  int c, fd, listener = -1, yes = 1, ms = -1;
+
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_remote_start: start\n");
+#endif
+
+  // Listening on the TCP port, a port per task
+  optimize->nservers = 0;
+  optimize->server = NULL;
+  optimize->queue_server = g_async_queue_new ();
+  snprintf (buffer, 64, "%u", input->port + optimize->rank);
+  memset (&hints, 0, sizeof (hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = AI_PASSIVE;
+  if (getaddrinfo (NULL, buffer, &hints, &address))
+    goto exit_on_error;
+  for (a = address; a; a = a->ai_next)
+    {
+      listener = socket (a->ai_family, a->ai_socktype, a->ai_protocol);
+      if (listener < 0)
+        continue;
+      setsockopt (listener, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof (int));
+      if (!bind (listener, a->ai_addr, a->ai_addrlen)
+          && !listen (listener, SOMAXCONN))
+        break;
+      close (listener);
+      listener = -1;
+    }
+  freeaddrinfo (address);
+  if (listener < 0)
+    goto exit_on_error;
+
+  // Accepting the slots of the worker daemons, waiting at most input->timeout
+  // seconds
+  printf ("%s: %s\n", _("Waiting for the worker daemons on port"), buffer);
+  pfd->fd = listener;
+  pfd->events = POLLIN;
+  if (input->timeout)
+    t = g_get_monotonic_time () + (gint64) input->timeout * G_USEC_PER_SEC;
+  for (nworkers = nexpected = 0;
+       nworkers < input->workers || optimize->nservers < nexpected;)
+    {
+      if (input->timeout)
+        {
+          ms = (int) ((t - g_get_monotonic_time ()) / 1000);
+          if (ms <= 0)
+            {
+              close (listener);
+              goto exit_on_error;
+            }
+        }
+      c = poll (pfd, 1, ms);
+      if (c < 0 && errno == EINTR)
+        continue;
+      if (c <= 0)
+        {
+          close (listener);
+          goto exit_on_error;
+        }
+      fd = accept (listener, NULL, NULL);
+      if (fd < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          close (listener);
+          goto exit_on_error;
+        }
+      setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof (int));
+      optimize->server
+        = (Server *) g_realloc (optimize->server,
+                                (optimize->nservers + 1) * sizeof (Server));
+      server = optimize->server + optimize->nservers;
+      server->pid = 0;
+      server->request = fdopen (fd, "wb");
+      server->reply = fdopen (dup (fd), "rb");
+      setvbuf (server->reply, NULL, _IONBF, 0);
+      if (!optimize_server_receive (server, buffer, 64)
+          || sscanf (buffer, WORKER_GREETING " %u %u", &slots, &slot) != 2)
+        {
+          optimize_server_close (server);
+          continue;
+        }
+      if (!slot)
+        {
+          printf ("%s %u: %u %s\n", _("Worker"), ++nworkers, slots,
+                  _("slots"));
+          nexpected += slots;
+        }
+      ++optimize->nservers;
+    }
+  close (listener);
+
+  // Queuing the idle slots
+  for (slot = 0; slot < optimize->nservers; ++slot)
+    g_async_queue_push (optimize->queue_server, optimize->server + slot);
+  optimize->nremotes = (int) optimize->nservers;
+  optimize->nthreads_climbing = optimize->nthreads = optimize->nservers;
+
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_remote_start: nslots=%u\n", optimize->nservers);
+  fprintf (stderr, "optimize_remote_start: end\n");
+#endif
+  return 1;
+
+exit_on_error:
+  snprintf (buffer, 64, "%u", input->port + optimize->rank);
+  error_message = g_strconcat (_("Unable to wait for the worker daemons"),
+                               ":\n", _("port"), " ", buffer, NULL);
+  jb_show_error (error_message);
+  g_free (error_message);
+#if DEBUG_OPTIMIZE
+  fprintf (stderr, "optimize_remote_start: end\n");
+#endif
+  return 0;
+#endif
+}
+
 /**
  * Function to open and perform a optimization.
+ *
+ * \return 1 on success, 0 on error.
  */
-void
+int
 optimize_open ()
 {
   GTimeZone *tz;
   GDateTime *t0, *t;
+  double time_mean, mean, deviation;
   unsigned int i, j, nsteps;
 
 #if DEBUG_OPTIMIZE
@@ -1550,28 +4450,139 @@ optimize_open ()
   // Getting results file names
   optimize->result = input->result;
   optimize->variables = input->variables;
+#if !HAVE_MPI
+  if (optimize->rank)
+    {
+      // Local worker processes share the working directory
+      optimize->result
+        = g_strdup_printf ("%s.%d", input->result, optimize->rank);
+      optimize->variables
+        = g_strdup_printf ("%s.%d", input->variables, optimize->rank);
+    }
+#endif
 
   // Obtaining the simulator file
-  optimize->simulator = input->simulator;
+  optimize->simulator = optimize_program (input->simulator);
 
   // Obtaining the evaluator file
-  optimize->evaluator = input->evaluator;
+  optimize->evaluator = optimize_program (input->evaluator);
 
   // Obtaining the cleaner file
-  optimize->cleaner = input->cleaner;
+  optimize->cleaner = optimize_program (input->cleaner);
+
+  // Obtaining the threads numbers, replaced by the slots of the worker daemons
+  optimize->nthreads = nthreads;
+  optimize->nthreads_climbing = nthreads_climbing;
+
+  // Loading the simulator plugin
+  optimize_objective = optimize_parse;
+  if (input->plugin)
+    {
+      if (!optimize_plugin_open (input->plugin))
+        {
+          g_date_time_unref (t0);
+          g_time_zone_unref (tz);
+          return 0;
+        }
+      optimize_objective = optimize_plugin;
+    }
+
+  // Launching the persistent simulator processes
+  else if (input->server)
+    {
+      if (!optimize_server_start ())
+        {
+          g_date_time_unref (t0);
+          g_time_zone_unref (tz);
+          return 0;
+        }
+      optimize_objective = optimize_server;
+    }
+
+  // Waiting for the worker daemons
+  else if (input->port)
+    {
+      if (!optimize_remote_start ())
+        {
+          g_date_time_unref (t0);
+          g_time_zone_unref (tz);
+          return 0;
+        }
+      optimize_objective = optimize_remote;
+    }
+
+  // Opening the persistent evaluation database
+  if (input->database)
+    {
+      optimize->database = (Database *) g_malloc (sizeof (Database));
+      if (!database_open (optimize->database, input->database))
+        {
+          g_free (optimize->database);
+          optimize->database = NULL;
+          jb_show_error (error_message);
+          g_free (error_message);
+          g_date_time_unref (t0);
+          g_time_zone_unref (tz);
+          return 0;
+        }
+      optimize_database_simulate = optimize_objective;
+      optimize_objective = optimize_stored;
+    }
+
+  // Opening the evaluation cache
+  optimize->cache_hits = optimize->cache_misses = 0;
+  if (input->cache)
+    {
+      if (optimize_objective == optimize_server
+          || optimize_objective == optimize_remote)
+        optimize_cache_values = 1;
+      else if (optimize_objective == optimize_plugin
+               && optimize_plugin_variables)
+        optimize_cache_values = 2;
+      else
+        optimize_cache_values = 0;
+      optimize_simulate = optimize_objective;
+      optimize_objective = optimize_cached;
+      optimize->cache = (Cache *) g_malloc (NCACHES * sizeof (Cache));
+      for (i = 0; i < NCACHES; ++i)
+        {
+          g_mutex_init (optimize->cache[i].mutex);
+          optimize->cache[i].table
+            = g_hash_table_new_full (optimize_cache_hash, optimize_cache_equal,
+                                     g_free, g_free);
+        }
+    }
 
   // Reading the algorithm
   optimize->algorithm = input->algorithm;
   switch (optimize->algorithm)
     {
     case ALGORITHM_MONTE_CARLO:
-      optimize_algorithm = optimize_MonteCarlo;
+      optimize_algorithm = optimize_sampling;
+      optimize_sample = optimize_MonteCarlo;
       break;
     case ALGORITHM_SWEEP:
-      optimize_algorithm = optimize_sweep;
+      optimize_algorithm = optimize_sampling;
+      optimize_sample = optimize_sweep;
       break;
     case ALGORITHM_ORTHOGONAL:
-      optimize_algorithm = optimize_orthogonal;
+      optimize_algorithm = optimize_sampling;
+      optimize_sample = optimize_orthogonal;
+      break;
+    case ALGORITHM_SURROGATE:
+      optimize_algorithm = optimize_sampling;
+      optimize_sample = optimize_surrogate;
+      break;
+    case ALGORITHM_SOBOL:
+      optimize_algorithm = optimize_sampling;
+      optimize_sample = optimize_sobol;
+      break;
+    case ALGORITHM_LATIN:
+      optimize_algorithm = optimize_sampling;
+      optimize_sample = optimize_latin;
+      break;
+    case ALGORITHM_CMAES:
+      optimize_algorithm = optimize_cmaes;
       break;
     default:
       optimize_algorithm = optimize_genetic;
@@ -1582,6 +4593,12 @@ optimize_open ()
   optimize->nvariables = input->nvariables;
   optimize->nsimulations = input->nsimulations;
   optimize->niterations = input->niterations;
+  optimize->nrestarts = 0;
+  if (optimize->algorithm == ALGORITHM_CMAES)
+    {
+      optimize->nrestarts = input->nrestarts;
+      optimize->nsimulations <<= optimize->nrestarts;
+    }
   optimize->nbest = input->nbest;
   optimize->tolerance = input->tolerance;
   optimize->nsteps = input->nsteps;
@@ -1589,6 +4606,18 @@ optimize_open ()
   nsteps = JBM_MAX (optimize->nsteps, optimize->nfinal_steps);
   optimize->nestimates = 0;
   optimize->threshold = input->threshold;
+  optimize->binary = input->binary;
+  optimize->prune = input->prune;
+  optimize->pipeline = input->pipeline;
+  optimize->chunk = input->chunk;
+  optimize->dynamic = 0;
+#if HAVE_MPI
+  optimize->dynamic = optimize->chunk && ntasks > 1
+    && optimize->algorithm != ALGORITHM_GENETIC
+    && optimize->algorithm != ALGORITHM_SURROGATE
+    && optimize->algorithm != ALGORITHM_CMAES;
+#endif
+  optimize->nsimulations_pruned = optimize->nexperiments_pruned = 0;
   optimize->stop = 0;
   if (nsteps)
     {
@@ -1598,19 +4627,37 @@ optimize_open ()
         case CLIMBING_METHOD_COORDINATES:
           optimize->nestimates = 2 * optimize->nvariables;
           optimize_estimate_climbing = optimize_estimate_climbing_coordinates;
+          optimize_climbing_method = optimize_climbing;
+          break;
+        case CLIMBING_METHOD_SIMPLEX:
+          optimize->nreflections
+            = JBM_MIN (input->nestimates, optimize->nvariables);
+          optimize->nestimates
+            = JBM_MAX (3 * optimize->nreflections, optimize->nvariables);
+          optimize_climbing_method = optimize_simplex;
           break;
         default:
           optimize->nestimates = input->nestimates;
           optimize_estimate_climbing = optimize_estimate_climbing_random;
+          optimize_climbing_method = optimize_climbing;
         }
+      optimize->nclimbers = input->nclimbers;
     }
+  else
+    optimize->nclimbers = 1;
 
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_open: nbest=%u\n", optimize->nbest);
 #endif
   optimize->simulation_best
-    = (unsigned int *) alloca (optimize->nbest * sizeof (unsigned int));
-  optimize->error_best = (double *) alloca (optimize->nbest * sizeof (double));
+    = (unsigned int *) g_malloc (optimize->nbest * sizeof (unsigned int));
+  optimize->simulation_merge
+    = (unsigned int *) g_malloc (optimize->nbest * sizeof (unsigned int));
+  optimize->error_best = (double *) g_malloc (optimize->nbest * sizeof (double));
+  optimize->error_merge
+    = (double *) g_malloc (optimize->nbest * sizeof (double));
+  optimize->best_task = (Best *) g_malloc (optimize->nbest * sizeof (Best));
+  optimize->best_merged = (Best *) g_malloc (optimize->nbest * sizeof (Best));
 
   // Reading the experimental data
 #if DEBUG_OPTIMIZE
@@ -1624,8 +4671,12 @@ optimize_open ()
     = (char **) alloca (input->nexperiments * sizeof (char *));
   optimize->weight = (double *) alloca (input->nexperiments * sizeof (double));
   for (i = 0; i < input->experiment->ninputs; ++i)
-    optimize->file[i] = (GMappedFile **)
-      g_malloc (input->nexperiments * sizeof (GMappedFile *));
+    {
+      optimize->file[i] = (GMappedFile **)
+        g_malloc (input->nexperiments * sizeof (GMappedFile *));
+      optimize->template[i] = (Template *)
+        g_malloc (input->nexperiments * sizeof (Template));
+    }
   for (i = 0; i < input->nexperiments; ++i)
     {
 #if DEBUG_OPTIMIZE
@@ -1644,6 +4695,15 @@ optimize_open ()
 #endif
           optimize->file[j][i]
             = g_mapped_file_new (input->experiment[i].stencil[j], 0, NULL);
+
+          // Precompiling the template
+          if ((optimize->template_flags & (1u << j)) && optimize->file[j][i])
+            template_new (optimize->template[j] + i,
+                          g_mapped_file_get_contents (optimize->file[j][i]),
+                          g_mapped_file_get_length (optimize->file[j][i]),
+                          input->nvariables);
+          else
+            template_new (optimize->template[j] + i, NULL, 0, 0);
         }
     }
 
@@ -1688,8 +4748,34 @@ optimize_open ()
         }
     }
   if (nsteps)
-    optimize->climbing
-      = (double *) alloca (optimize->nvariables * sizeof (double));
+    {
+      j = optimize->nclimbers * optimize->nvariables * sizeof (double);
+      optimize->climbing = (double *) alloca (j);
+      if (optimize->nclimbers > 1)
+        optimize->step = (double *) memcpy (alloca (j), optimize->step,
+                                            optimize->nvariables
+                                            * sizeof (double));
+      j = optimize->nclimbers * sizeof (unsigned int);
+      optimize->climber_origin = (unsigned int *) g_malloc (j);
+      optimize->climber_adjust = (unsigned int *) g_malloc (j);
+      if (input->climbing == CLIMBING_METHOD_SIMPLEX)
+        {
+          optimize->simplex_state = (unsigned int *) g_malloc (j);
+          optimize->simplex_start = (unsigned int *) g_malloc (j);
+          j = optimize->nclimbers * (optimize->nvariables + 1);
+          optimize->simplex_vertex
+            = (unsigned int *) g_malloc (j * sizeof (unsigned int));
+          optimize->error_vertex = (double *) g_malloc (j * sizeof (double));
+          optimize->error_simplex = (double *)
+            g_malloc (optimize->nclimbers * optimize->nestimates
+                      * sizeof (double));
+          optimize->simplex_origin = (double *)
+            g_malloc (optimize->nclimbers * optimize->nvariables
+                      * sizeof (double));
+          optimize->simplex_centroid
+            = (double *) g_malloc (optimize->nvariables * sizeof (double));
+        }
+    }
 
   // Setting error norm
   switch (input->norm)
@@ -1714,6 +4800,12 @@ optimize_open ()
   fprintf (stderr, "optimize_open: nvariables=%u algorithm=%u\n",
            optimize->nvariables, optimize->algorithm);
 #endif
+  optimize->range
+    = (double *) g_malloc (optimize->nvariables * sizeof (double));
+  optimize->sobol_point = NULL;
+  if (optimize->algorithm == ALGORITHM_SOBOL)
+    optimize->sobol_point
+      = (double *) g_malloc (optimize->nvariables * sizeof (double));
   optimize->genetic_variable = NULL;
   if (optimize->algorithm == ALGORITHM_GENETIC)
     {
@@ -1731,62 +4823,160 @@ optimize_open ()
           optimize->genetic_variable[i].nbits = optimize->nbits[i];
         }
     }
+  optimize->surrogate_value = optimize->surrogate_error
+    = optimize->surrogate_scale = optimize->candidate_value
+    = optimize->candidate_improvement = NULL;
+  optimize->nsurrogates = optimize->ncandidates = 0;
+  if (optimize->algorithm == ALGORITHM_SURROGATE)
+    {
+      j = optimize->nsimulations * optimize->niterations;
+      optimize->surrogate_value
+        = (double *) g_malloc (j * optimize->nvariables * sizeof (double));
+      optimize->surrogate_error = (double *) g_malloc (j * sizeof (double));
+      optimize->surrogate_scale
+        = (double *) g_malloc (optimize->nvariables * sizeof (double));
+      optimize->surrogate_best = INFINITY;
+      optimize->ncandidates = SURROGATE_NCANDIDATES * optimize->nsimulations;
+      optimize->candidate_value = (double *)
+        g_malloc (optimize->ncandidates * optimize->nvariables
+                  * sizeof (double));
+      optimize->candidate_improvement
+        = (double *) g_malloc (optimize->ncandidates * sizeof (double));
+    }
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_open: nvariables=%u nsimulations=%u\n",
            optimize->nvariables, optimize->nsimulations);
 #endif
-  optimize->value = (double *)
-    g_malloc ((optimize->nsimulations + optimize->nestimates * nsteps)
-              * optimize->nvariables * sizeof (double));
+
+  // Checking the pipelined iterations mode
+  optimize->pipelined = optimize->pipeline < 1.
+    && optimize->algorithm != ALGORITHM_GENETIC
+    && optimize->algorithm != ALGORITHM_SURROGATE
+    && optimize->algorithm != ALGORITHM_CMAES && !optimize->nsteps
+    && optimize->niterations > 1 && optimize->nthreads > 1 && ntasks == 1;
+  optimize->nrows = optimize->nsimulations
+    + optimize->nclimbers * optimize->nestimates * nsteps;
+  j = optimize->nrows;
+  if (optimize->pipelined)
+    j *= NPASSES;
+  optimize->value
+    = (double *) g_malloc (j * optimize->nvariables * sizeof (double));
+  optimize->error_experiment
+    = (double *) g_malloc (j * optimize->nexperiments * sizeof (double));
+  optimize->nexperiments_left = (int *) g_malloc (j * sizeof (int));
+  optimize->pruned = (unsigned char *) g_malloc (j);
 
   // Calculating simulations to perform for each task
-#if HAVE_MPI
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_open: rank=%u ntasks=%u\n",
-           optimize->mpi_rank, ntasks);
+           optimize->rank, ntasks);
 #endif
-  optimize->nstart = optimize->mpi_rank * optimize->nsimulations / ntasks;
-  optimize->nend = (1 + optimize->mpi_rank) * optimize->nsimulations / ntasks;
-  if (nsteps)
-    {
-      optimize->nstart_climbing
-        = optimize->mpi_rank * optimize->nestimates / ntasks;
-      optimize->nend_climbing
-        = (1 + optimize->mpi_rank) * optimize->nestimates / ntasks;
-    }
-#else
-  optimize->nstart = 0;
-  optimize->nend = optimize->nsimulations;
+  optimize->nstart = optimize->rank * optimize->nsimulations / ntasks;
+  optimize->nend = (1 + optimize->rank) * optimize->nsimulations / ntasks;
   if (nsteps)
     {
-      optimize->nstart_climbing = 0;
-      optimize->nend_climbing = optimize->nestimates;
+      j = optimize->nclimbers * optimize->nestimates;
+      optimize->nstart_climbing = optimize->rank * j / ntasks;
+      optimize->nend_climbing = (1 + optimize->rank) * j / ntasks;
     }
-#endif
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_open: nstart=%u nend=%u\n", optimize->nstart,
            optimize->nend);
 #endif
 
-  // Calculating simulations to perform for each thread
-  optimize->thread
-    = (unsigned int *) alloca ((1 + nthreads) * sizeof (unsigned int));
-  for (i = 0; i <= nthreads; ++i)
-    {
-      optimize->thread[i] = optimize->nstart
-        + i * (optimize->nend - optimize->nstart) / nthreads;
-#if DEBUG_OPTIMIZE
-      fprintf (stderr, "optimize_open: i=%u thread=%u\n", i,
-               optimize->thread[i]);
+  // Initing the thread load statistics
+  optimize->nworkers = optimize->nthreads;
+  if (nsteps)
+    optimize->nworkers
+      = JBM_MAX (optimize->nthreads, optimize->nthreads_climbing);
+  optimize->nslots = optimize->nworkers;
+  if (optimize->pipelined)
+    optimize->nslots *= NPASSES;
+  optimize->time_busy
+    = (double *) g_malloc0 (optimize->nworkers * sizeof (double));
+  optimize->time_idle
+    = (double *) g_malloc0 (optimize->nworkers * sizeof (double));
+
+  // Initing the experiment statistics
+  j = optimize->nslots * optimize->nexperiments;
+  optimize->experiment_time = (double *) g_malloc0 (j * sizeof (double));
+  optimize->experiment_sum = (double *) g_malloc0 (j * sizeof (double));
+  optimize->experiment_sum2 = (double *) g_malloc0 (j * sizeof (double));
+  optimize->experiment_count
+    = (unsigned int *) g_malloc0 (j * sizeof (unsigned int));
+  optimize->experiment_calculations
+    = (unsigned int *) g_malloc0 (j * sizeof (unsigned int));
+  optimize->experiment_score
+    = (double *) g_malloc (optimize->nexperiments * sizeof (double));
+  optimize->experiment_order = (unsigned int *)
+    g_malloc (optimize->nexperiments * sizeof (unsigned int));
+  for (i = 0; i < optimize->nexperiments; ++i)
+    optimize->experiment_order[i] = i;
+
+  // Allocating the heaps of the best simulations of every thread
+  j = optimize->nbest;
+  if (nsteps && (optimize->nclimbers > 1
+                 || optimize_climbing_method == optimize_simplex))
+    j = JBM_MAX (j, optimize->nclimbers * optimize->nestimates);
+  if (optimize->algorithm == ALGORITHM_CMAES
+      || optimize->algorithm == ALGORITHM_GENETIC)
+    j = JBM_MAX (j, optimize->nsimulations);
+  optimize->simulation_heap = (unsigned int *)
+    g_malloc (optimize->nworkers * j * sizeof (unsigned int));
+  optimize->error_heap
+    = (double *) g_malloc (optimize->nworkers * j * sizeof (double));
+  optimize->parallel_data = (ParallelData *)
+    g_malloc (optimize->nworkers * sizeof (ParallelData));
+
+#if HAVE_MPI
+  // Creating the MPI reduction of the best simulations
+  optimize->mpi_best_type = best_mpi_type (optimize->nbest);
+  optimize->mpi_best_op = best_mpi_op ();
 #endif
+
+  // Allocating the data of the pipelined passes
+  optimize->pipeline_data = NULL;
+  optimize->pipeline_best->simulation_best = NULL;
+  optimize->pipeline_best->error_best = NULL;
+  optimize->pipeline_best->nbest = optimize->pipeline_best->nsaveds = 0;
+  for (i = 0; i < NPASSES; ++i)
+    optimize->npending[i] = optimize->nleft[i] = 0;
+  if (optimize->pipelined || optimize->dynamic)
+    {
+      optimize->pipeline_data = (ParallelData *)
+        g_malloc0 (optimize->nslots * sizeof (ParallelData));
+      optimize->pipeline_best->simulation_best = (unsigned int *)
+        g_malloc (optimize->nbest * sizeof (unsigned int));
+      optimize->pipeline_best->error_best
+        = (double *) g_malloc (optimize->nbest * sizeof (double));
+      optimize->pipeline_best->nbest = optimize->nbest;
     }
-  if (nsteps)
-    optimize->thread_climbing = (unsigned int *)
-      alloca ((1 + nthreads_climbing) * sizeof (unsigned int));
+
+  // Creating the pools of persistent worker threads
+  optimize->pool = NULL;
+  if (optimize->nworkers > 1)
+    optimize->pool
+      = g_thread_pool_new ((GFunc) optimize_pool_run, NULL,
+                           (int) optimize->nworkers, TRUE, NULL);
+  optimize->pool_surrogate = NULL;
+  if (optimize->algorithm == ALGORITHM_SURROGATE && optimize->nthreads > 1)
+    optimize->pool_surrogate
+      = g_thread_pool_new (optimize_surrogate_run, NULL,
+                           (int) optimize->nthreads - 1, TRUE, NULL);
 
   // Opening result files
   optimize->file_result = g_fopen (optimize->result, "w");
-  optimize->file_variables = g_fopen (optimize->variables, "w");
+  optimize->file_variables
+    = g_fopen (optimize->variables, optimize->binary ? "wb" : "w");
+  setvbuf (optimize->file_variables, NULL, _IONBF, 0);
+  if (optimize->binary)
+    binary_write_header (optimize->file_variables, optimize->label,
+                         optimize->precision, optimize->nvariables);
+
+  // Starting the variables file writer
+  optimize->queue_variables = g_async_queue_new ();
+  optimize->thread_variables
+    = g_thread_new (NULL, optimize_variables_thread, NULL);
 
   // Performing the algorithm
   switch (optimize->algorithm)
@@ -1796,6 +4986,11 @@ optimize_open ()
       optimize_genetic ();
       break;
 
+      // CMA-ES algorithm
+    case ALGORITHM_CMAES:
+      optimize_cmaes ();
+      break;
+
       // Iterative algorithm
     default:
       optimize_iterate ();
@@ -1811,12 +5006,109 @@ optimize_open ()
   fprintf (optimize->file_result, "%s = %.6lg s\n",
            _("Calculation time"), optimize->calculation_time);
 
+  // Saving the evaluation cache statistics
+  if (optimize->cache)
+    {
+      printf ("%s = %d %s = %d\n", _("Cache hits"), optimize->cache_hits,
+              _("Cache misses"), optimize->cache_misses);
+      fprintf (optimize->file_result, "%s = %d %s = %d\n", _("Cache hits"),
+               optimize->cache_hits, _("Cache misses"), optimize->cache_misses);
+    }
+  if (optimize->database)
+    {
+      printf ("%s = %d %s = %d\n", _("Database hits"),
+              optimize->database->hits, _("Database misses"),
+              optimize->database->misses);
+      fprintf (optimize->file_result, "%s = %d %s = %d\n", _("Database hits"),
+               optimize->database->hits, _("Database misses"),
+               optimize->database->misses);
+    }
+
+  // Saving the pruning statistics
+  if (optimize->prune)
+    {
+      printf ("%s = %d %s = %d\n", _("Pruned simulations"),
+              optimize->nsimulations_pruned, _("Pruned experiments"),
+              optimize->nexperiments_pruned);
+      fprintf (optimize->file_result, "%s = %d %s = %d\n",
+               _("Pruned simulations"), optimize->nsimulations_pruned,
+               _("Pruned experiments"), optimize->nexperiments_pruned);
+    }
+
+  // Saving the experiment statistics
+  for (i = 0; i < optimize->nexperiments; ++i)
+    {
+      j = optimize_experiment_statistics (i, &time_mean, &mean, &deviation);
+      if (time_mean > 0.)
+        {
+          printf ("%s %s: %s = %.6lg s %s = %u %s = %.6lg %s = %.6lg\n",
+                  _("Experiment"), optimize->experiment[i], _("mean time"),
+                  time_mean, _("values"), j, _("mean"), mean, _("deviation"),
+                  deviation);
+          fprintf (optimize->file_result,
+                   "%s %s: %s = %.6lg s %s = %u %s = %.6lg %s = %.6lg\n",
+                   _("Experiment"), optimize->experiment[i], _("mean time"),
+                   time_mean, _("values"), j, _("mean"), mean, _("deviation"),
+                   deviation);
+        }
+    }
+  if (optimize->prune)
+    {
+      printf ("%s:", _("Experiments order"));
+      fprintf (optimize->file_result, "%s:", _("Experiments order"));
+      for (i = 0; i < optimize->nexperiments; ++i)
+        {
+          printf (" %s", optimize->experiment[optimize->experiment_order[i]]);
+          fprintf (optimize->file_result, " %s",
+                   optimize->experiment[optimize->experiment_order[i]]);
+        }
+      printf ("\n");
+      fprintf (optimize->file_result, "\n");
+    }
+
+  // Saving the thread load statistics
+  for (i = 0; i < optimize->nworkers; ++i)
+    if (optimize->time_busy[i] > 0. || optimize->time_idle[i] > 0.)
+      {
+        printf ("%s %u: %s = %.6lg s %s = %.6lg s\n", _("Thread"), i,
+                _("busy time"), optimize->time_busy[i], _("idle time"),
+                optimize->time_idle[i]);
+        fprintf (optimize->file_result, "%s %u: %s = %.6lg s %s = %.6lg s\n",
+                 _("Thread"), i, _("busy time"), optimize->time_busy[i],
+                 _("idle time"), optimize->time_idle[i]);
+      }
+
+#if HAVE_MPI
+  // Freeing the MPI reduction of the best simulations
+  MPI_Op_free (&optimize->mpi_best_op);
+  MPI_Type_free (&optimize->mpi_best_type);
+#endif
+
+  // Freeing the pools of persistent worker threads
+  if (optimize->pool)
+    {
+      g_thread_pool_free (optimize->pool, FALSE, TRUE);
+      optimize->pool = NULL;
+    }
+  if (optimize->pool_surrogate)
+    {
+      g_thread_pool_free (optimize->pool_surrogate, FALSE, TRUE);
+      optimize->pool_surrogate = NULL;
+    }
+
+  // Stopping the variables file writer
+  g_async_queue_push (optimize->queue_variables, optimize_variables_end);
+  g_thread_join (optimize->thread_variables);
+  g_async_queue_unref (optimize->queue_variables);
+
   // Closing result files
-  optimize_save_optimal ();
+  if (!optimize->rank)
+    optimize_save_optimal ();
   fclose (optimize->file_variables);
   fclose (optimize->file_result);
 
 #if DEBUG_OPTIMIZE
   fprintf (stderr, "optimize_open: end\n");
 #endif
+  return 1;
 }
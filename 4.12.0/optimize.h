@@ -38,6 +38,47 @@ OF SUCH DAMAGE.
 #ifndef OPTIMIZE__H
 #define OPTIMIZE__H 1
 
+/**
+ * \struct Server
+ * \brief Struct to define a persistent simulator process or a slot of a
+ *   worker daemon.
+ */
+typedef struct
+{
+  FILE *request;                ///< Pipe to send the simulation requests.
+  FILE *reply;                  ///< Pipe to receive the objective values.
+  GPid pid;                     ///< Process identifier, 0 on worker slots.
+} Server;
+
+/**
+ * \struct Cache
+ * \brief Struct to define a shard of the evaluation cache.
+ */
+typedef struct
+{
+  GMutex mutex[1];              ///< Mutex to access the table.
+  GHashTable *table;
+  ///< Hash table of objective function values by simulation digest.
+} Cache;
+
+/**
+ * \struct ParallelData
+ * \brief Struct to pass to the GThreads parallelized function.
+ */
+typedef struct
+{
+  unsigned int *simulation_best;
+  ///< Heap of best simulation numbers of the thread.
+  double *error_best;           ///< Heap of best errors of the thread.
+  double bound;
+  ///< Objective function value to prune the simulations of the pass.
+  gint64 busy;                  ///< Busy time in microseconds.
+  unsigned int nbest;           ///< Maximum size of the heap.
+  unsigned int nsaveds;         ///< Number of saved simulations.
+  unsigned int thread;          ///< Thread number.
+  unsigned int pass;            ///< Number of the concurrent parallel pass.
+} ParallelData;
+
 /**
  * \struct Optimize
  * \brief Struct to define the optimization ation data.
@@ -45,6 +86,8 @@ OF SUCH DAMAGE.
 typedef struct
 {
   GMappedFile **file[MAX_NINPUTS];      ///< Matrix of input template files.
+  Template *template[MAX_NINPUTS];
+  ///< Matrix of precompiled input template files.
   char **experiment;            ///< Array of experimental data file names.
   char **label;                 ///< Array of variable names.
   gsl_rng *rng;                 ///< GSL random number generator.
@@ -52,6 +95,30 @@ typedef struct
   ///< Array of variables for the genetic algorithm.
   FILE *file_result;            ///< Result file.
   FILE *file_variables;         ///< Variables file.
+  Server *server;               ///< Array of persistent simulator processes.
+  GAsyncQueue *queue_server;    ///< Queue of idle simulator processes.
+  GThreadPool *pool;            ///< Pool of persistent worker threads.
+  GThreadPool *pool_surrogate;
+  ///< Pool of persistent threads calculating the surrogate model predictions.
+  GAsyncQueue *queue_variables;
+  ///< Queue of the rows to write in the variables file.
+  GThread *thread_variables;    ///< Thread writing the variables file.
+  GMutex pool_mutex[1];         ///< Mutex to wait for the pool threads.
+  GCond pool_cond[1];           ///< Condition to wait for the pool threads.
+  GMutex surrogate_mutex[1];
+  ///< Mutex to wait for the threads of the surrogate model predictions.
+  GCond surrogate_cond[1];
+  ///< Condition to wait for the threads of the surrogate model predictions.
+  ParallelData *parallel_data;
+  ///< Array of thread data of the parallel passes.
+  ParallelData *pipeline_data;
+  ///< Array of thread data of the concurrent pipelined passes.
+  ParallelData pipeline_best[1];
+  ///< Best simulations finished on the pipelined iterations.
+  GMutex mutex_simulation[NLOCKS];
+  ///< Array of mutexes to access the experiment errors of the simulations.
+  Cache *cache;                 ///< Array of evaluation cache shards.
+  Database *database;           ///< Persistent evaluation database.
   char *result;                 ///< Name of the result file.
   char *variables;              ///< Name of the variables file.
   char *simulator;              ///< Name of the simulator program.
@@ -63,6 +130,9 @@ typedef struct
   double *rangemax;             ///< Array of maximum variable values.
   double *rangeminabs;          ///< Array of absolute minimum variable values.
   double *rangemaxabs;          ///< Array of absolute maximum variable values.
+  double *range;                ///< Array of sampling intervals of variables.
+  double *sobol_point;
+  ///< Array of the variable values of a point of the Sobol sequence.
   double *error_best;           ///< Array of the best minimum errors.
   double *weight;               ///< Array of the experiment weights.
   double *step;                 ///< Array of hill climbing method step sizes.
@@ -75,12 +145,83 @@ typedef struct
   unsigned int *nsweeps;        ///< Array of sweeps of the sweep algorithm.
   unsigned int *nbits;
   ///< Array of bits number of the genetic algorithm.
-  unsigned int *thread;
-  ///< Array of simulation numbers to calculate on the thread.
-  unsigned int *thread_climbing;
-  ///< Array of simulation numbers to calculate on the thread for the hill
-  ///< climbing method.
+  double *error_experiment;
+  ///< Array of the weighted objective function values of every experiment of
+  ///< every simulation.
+  double *error_merge;
+  ///< Array of the best minimum errors to merge the results.
+  double *value_merge;
+  ///< Array of the best variable values to merge the results.
+  double *error_heap;
+  ///< Array of the best minimum errors of every thread.
+  double *error_simplex;
+  ///< Array of the objective function values of a step of the simplex method.
+  double *error_vertex;
+  ///< Array of the objective function values of the vertices of the simplex
+  ///< method climbers.
+  double *simplex_origin;
+  ///< Array of the variable values of the starting simulations of the simplex
+  ///< method climbers.
+  double *simplex_centroid;
+  ///< Array of the variable values of the centroid of a simplex.
+  double *error_generation;
+  ///< Array of the objective function values of a generation of the
+  ///< evolutionary algorithms.
+  double *time_busy;            ///< Array of thread busy times.
+  double *time_idle;            ///< Array of thread idle times.
+  double *experiment_time;
+  ///< Array of the calculation times of every experiment and thread.
+  double *experiment_sum;
+  ///< Array of the objective function sums of every experiment and thread.
+  double *experiment_sum2;
+  ///< Array of the squared objective function sums of every experiment and
+  ///< thread.
+  unsigned int *experiment_count;
+  ///< Array of the finite objective function numbers of every experiment and
+  ///< thread.
+  unsigned int *experiment_calculations;
+  ///< Array of the calculation numbers of every experiment and thread.
+  double *experiment_score;
+  ///< Array of scores to order the experiments.
+  unsigned int *experiment_order;
+  ///< Array of experiment numbers in calculation order.
   unsigned int *simulation_best;        ///< Array of best simulation numbers.
+  int *nexperiments_left;
+  ///< Array of numbers of experiments to calculate of every simulation.
+  unsigned char *pruned;        ///< Array of pruned simulation flags.
+  unsigned int *simulation_merge;
+  ///< Array of best simulation numbers to merge the results.
+  Best *best_task;
+  ///< Set of best simulations of the task to synchronise the results.
+  Best *best_merged;
+  ///< Set of best simulations of all the tasks to synchronise the results.
+  unsigned int *simulation_heap;
+  ///< Array of best simulation numbers of every thread.
+  unsigned int *climber_origin;
+  ///< Array of the variable values positions of the climbers best simulations
+  ///< on the previous step.
+  unsigned int *climber_adjust;
+  ///< Array of flags to reduce the step sizes of the climbers.
+  unsigned int *simplex_vertex;
+  ///< Array of the simulation numbers of the vertices of the simplex method
+  ///< climbers.
+  unsigned int *simplex_state;
+  ///< Array of the states of the simplex method climbers.
+  unsigned int *simplex_start;
+  ///< Array of the first simulation numbers of the simplex method climbers on
+  ///< a step.
+  double *surrogate_value;
+  ///< Array of variable values of the points evaluated by the surrogate
+  ///< algorithm.
+  double *surrogate_error;
+  ///< Array of objective function values of the points evaluated by the
+  ///< surrogate algorithm.
+  double *surrogate_scale;
+  ///< Array of scale factors of the variables in the surrogate model.
+  double *candidate_value;
+  ///< Array of variable values of the candidates of the surrogate algorithm.
+  double *candidate_improvement;
+  ///< Array of expected improvements of the candidates.
   double tolerance;             ///< Algorithm tolerance.
   double mutation_ratio;        ///< Mutation probability.
   double reproduction_ratio;    ///< Reproduction probability.
@@ -89,6 +230,12 @@ typedef struct
   double calculation_time;      ///< Calculation time.
   double p;                     ///< Exponent of the P error norm.
   double threshold;             ///< Threshold to finish the optimization.
+  double pipeline;
+  ///< Fraction of finished simulations to start the next pipelined iteration.
+  double surrogate_best;
+  ///< Best objective function value evaluated by the surrogate algorithm.
+  double bound;
+  ///< Objective function value to prune the simulations of an iteration.
   unsigned long int seed;
   ///< Seed of the pseudo-random numbers generator.
   unsigned int nvariables;      ///< Variables number.
@@ -101,6 +248,17 @@ typedef struct
   ///< Number of steps to do the hill climbing method at the final pass.
   unsigned int nestimates;
   ///< Number of simulations to estimate the climbing.
+  unsigned int nclimbers;
+  ///< Number of hill climbing methods started from the best simulations.
+  unsigned int simulation_climbing;
+  ///< First simulation number of the current hill climbing step.
+  unsigned int nreflections;
+  ///< Number of vertices reflected at every step of the simplex method.
+  unsigned int nsurrogates;
+  ///< Number of points evaluated by the surrogate algorithm.
+  unsigned int ncandidates;     ///< Number of candidates of the surrogate pass.
+  unsigned int nsurrogate_pending;
+  ///< Number of pending shares of the surrogate model predictions.
   unsigned int algorithm;       ///< Algorithm type.
   unsigned int nstart;          ///< Beginning simulation number of the task.
   unsigned int nend;            ///< Ending simulation number of the task.
@@ -108,25 +266,51 @@ typedef struct
   ///< Beginning simulation number of the task for the hill climbing method.
   unsigned int nend_climbing;
   ///< Ending simulation number of the task for the hill climbing method.
+  unsigned int nnext[NPASSES];
+  ///< Next task (experiment of a simulation) to calculate of every parallel
+  ///< pass, shared by the threads.
+  unsigned int nlast[NPASSES];
+  ///< Ending task number of every parallel pass.
+  unsigned int npending[NPASSES];
+  ///< Number of pending jobs of every parallel pass on the pool.
+  unsigned int nleft[NPASSES];
+  ///< Number of simulations to finish of every pipelined pass.
+  unsigned int nworkers;        ///< Number of threads of the pool.
+  unsigned int nslots;          ///< Number of thread statistics slots.
+  unsigned int nrows;           ///< Number of simulations of a parallel pass.
+  unsigned int pipelined;
+  ///< 1 on pipelined iterations, 0 on synchronous iterations.
   unsigned int niterations;     ///< Number of algorithm iterations
+  unsigned int nrestarts;       ///< Number of IPOP restarts of CMA-ES.
   unsigned int nbest;           ///< Number of best simulations.
   unsigned int nsaveds;         ///< Number of saved simulations.
   unsigned int stop;            ///< To stop the simulations.
   unsigned int template_flags;  ///< Flags of template files.
+  unsigned int binary;
+  ///< 1 to write the variables file in binary format, 0 otherwise.
+  unsigned int prune;
+  ///< 1 to prune the simulations not entering the best set, 0 otherwise.
+  unsigned int chunk;
+  ///< Number of simulations of the chunks of the dynamic MPI scheduling.
+  unsigned int dynamic;
+  ///< 1 on dynamic MPI scheduling of the sampling passes, 0 otherwise.
+  unsigned int nthreads;         ///< Number of threads.
+  unsigned int nthreads_climbing;
+  ///< Number of threads of the hill climbing method.
+  unsigned int nservers;
+  ///< Number of persistent simulator processes or worker slots.
+  int nremotes;                 ///< Number of connected worker slots.
+  int cache_hits;               ///< Number of evaluations found in the cache.
+  int cache_misses;             ///< Number of evaluations not in the cache.
+  int nsimulations_pruned;      ///< Number of pruned simulations.
+  int nexperiments_pruned;      ///< Number of not calculated experiments.
 #if HAVE_MPI
-  int mpi_rank;                 ///< Number of MPI task.
+  MPI_Datatype mpi_best_type;   ///< MPI type of a set of best simulations.
+  MPI_Op mpi_best_op;           ///< MPI reduction of the best simulations.
 #endif
+  int rank;                     ///< Number of MPI task or local process.
 } Optimize;
 
-/**
- * \struct ParallelData
- * \brief Struct to pass to the GThreads parallelized function.
- */
-typedef struct
-{
-  unsigned int thread;          ///< Thread number.
-} ParallelData;
-
 // Global variables
 extern int ntasks;
 extern unsigned int nthreads;
@@ -136,6 +320,6 @@ extern Optimize optimize[1];
 
 // Public functions
 void optimize_free ();
-void optimize_open ();
+int optimize_open ();
 
 #endif
@@ -0,0 +1,74 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file plugin.h
+ * \brief Header file to define the simulator plugin entry points.
+ *
+ * A simulator plugin is a shared object, named by the plugin property of the
+ * input file, exporting one of the following functions. They are called
+ * concurrently from the worker threads so they have to be reentrant.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#ifndef PLUGIN__H
+#define PLUGIN__H 1
+
+#include <stddef.h>
+
+/**
+ * \def PLUGIN_VARIABLES
+ * \brief Name of the plugin function working with the variable values.
+ * \def PLUGIN_INPUTS
+ * \brief Name of the plugin function working with the rendered input files.
+ */
+#define PLUGIN_VARIABLES "mpcotool_variables"
+#define PLUGIN_INPUTS "mpcotool_inputs"
+
+/**
+ * \typedef PluginVariables
+ * \brief Function to calculate the objective function value of an experiment
+ *   from the array of variable values.
+ */
+typedef double (*PluginVariables) (const double *variable,
+                                   unsigned int nvariables,
+                                   unsigned int experiment, const char *data);
+
+/**
+ * \typedef PluginInputs
+ * \brief Function to calculate the objective function value of an experiment
+ *   from the contents of the input files (templates rendered in memory).
+ */
+typedef double (*PluginInputs) (const char **input, const size_t *length,
+                                unsigned int ninputs, unsigned int experiment,
+                                const char *data);
+
+#endif
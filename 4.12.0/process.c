@@ -0,0 +1,429 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file process.c
+ * \brief Source file to define the local worker processes communicating over
+ *   UNIX sockets without MPI.
+ *
+ * The master process forks the worker processes after reading the input file
+ * and every worker is connected with the master by a pair of UNIX sockets. The
+ * processes play the role of the MPI tasks: the best simulations are reduced
+ * on the master, the stop flag is reduced on all the processes and the search
+ * ranges are broadcasted from the master. A lost worker process is discarded
+ * by the master, so a crashed simulator does not stop the optimization.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <libxml/parser.h>
+#include <libintl.h>
+#include <glib.h>
+#include <json-glib/json-glib.h>
+#ifdef G_OS_WIN32
+#include <windows.h>
+#else
+#include <signal.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#endif
+#include "jb/src/win.h"
+#include "best.h"
+#include "process.h"
+
+#define DEBUG_PROCESS 0         ///< Macro to debug local processes functions.
+
+Process process[1];             ///< Local worker processes data.
+
+#ifndef G_OS_WIN32
+
+/**
+ * Function to write a message on a socket.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+process_write (int fd,          ///< Socket.
+               const void *data,        ///< Message data.
+               size_t size)     ///< Message size in bytes.
+{
+  const char *c;
+  ssize_t n;
+  for (c = (const char *) data; size; c += n, size -= (size_t) n)
+    {
+      n = write (fd, c, size);
+      if (n < 0)
+        {
+          if (errno != EINTR)
+            return 0;
+          n = 0;
+        }
+    }
+  return 1;
+}
+
+/**
+ * Function to read a message from a socket.
+ *
+ * \return 1 on success, 0 on error or if the socket is closed.
+ */
+static int
+process_read (int fd,           ///< Socket.
+              void *data,       ///< Message data.
+              size_t size)      ///< Message size in bytes.
+{
+  char *c;
+  ssize_t n;
+  for (c = (char *) data; size; c += n, size -= (size_t) n)
+    {
+      n = read (fd, c, size);
+      if (!n)
+        return 0;
+      if (n < 0)
+        {
+          if (errno != EINTR)
+            return 0;
+          n = 0;
+        }
+    }
+  return 1;
+}
+
+/**
+ * Function to discard a lost worker process on the master process.
+ */
+static void
+process_lost (unsigned int i)   ///< Number of worker process.
+{
+  fprintf (stderr, "%s: %u\n", _("Worker process lost"), i);
+  close (process->socket[i]);
+  process->socket[i] = -1;
+}
+
+#endif
+
+/**
+ * Function to fork the local worker processes. Every process returns from
+ *   this function with its rank number set.
+ *
+ * \return 1 on success, 0 on error.
+ */
+int
+process_open (unsigned int nprocesses)  ///< Number of processes.
+{
+#ifndef G_OS_WIN32
+  int sv[2];
+  unsigned int i, j;
+  pid_t pid;
+#endif
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_open: start\n");
+#endif
+  process->pid = NULL;
+  process->socket = NULL;
+  process->nprocesses = 1;
+  process->rank = 0;
+  if (nprocesses < 2)
+    return 1;
+#ifdef G_OS_WIN32
+  return 0;
+#else
+
+  // Writing to a lost process has to return an error instead of a signal
+  signal (SIGPIPE, SIG_IGN);
+
+  // Forking the worker processes
+  process->pid = (GPid *) g_malloc (nprocesses * sizeof (GPid));
+  process->socket = (int *) g_malloc (nprocesses * sizeof (int));
+  process->socket[0] = -1;
+  fflush (stdout);
+  fflush (stderr);
+  for (i = 1; i < nprocesses; ++i)
+    {
+      if (socketpair (AF_UNIX, SOCK_STREAM, 0, sv))
+        goto exit_on_error;
+      pid = fork ();
+      if (pid < 0)
+        {
+          close (sv[0]);
+          close (sv[1]);
+          goto exit_on_error;
+        }
+      if (!pid)
+        {
+          // Worker process
+          close (sv[0]);
+          for (j = 1; j < i; ++j)
+            close (process->socket[j]);
+          g_free (process->pid);
+          process->pid = NULL;
+          process->socket[0] = sv[1];
+          fcntl (sv[1], F_SETFD, FD_CLOEXEC);
+          process->nprocesses = nprocesses;
+          process->rank = (int) i;
+#if DEBUG_PROCESS
+          fprintf (stderr, "process_open: rank=%u\n", i);
+          fprintf (stderr, "process_open: end\n");
+#endif
+          return 1;
+        }
+
+      // Master process
+      close (sv[1]);
+      process->socket[i] = sv[0];
+      fcntl (sv[0], F_SETFD, FD_CLOEXEC);
+      process->pid[i] = pid;
+      process->nprocesses = i + 1;
+    }
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_open: nprocesses=%u\n", nprocesses);
+  fprintf (stderr, "process_open: end\n");
+#endif
+  return 1;
+
+exit_on_error:
+  for (j = 1; j < process->nprocesses; ++j)
+    kill (process->pid[j], SIGTERM);
+  process_close ();
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_open: end\n");
+#endif
+  return 0;
+#endif
+}
+
+/**
+ * Function to close the connections among the local processes and to wait for
+ *   the end of the worker processes.
+ */
+void
+process_close ()
+{
+#ifndef G_OS_WIN32
+  unsigned int i;
+  int status;
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_close: start\n");
+#endif
+  if (process->rank)
+    close (process->socket[0]);
+  else
+    for (i = 1; i < process->nprocesses; ++i)
+      {
+        if (process->socket[i] >= 0)
+          close (process->socket[i]);
+        while (waitpid (process->pid[i], &status, 0) == -1)
+          if (errno != EINTR)
+            break;
+      }
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_close: end\n");
+#endif
+#endif
+  g_free (process->socket);
+  g_free (process->pid);
+  process->socket = NULL;
+  process->pid = NULL;
+  process->nprocesses = 1;
+  process->rank = 0;
+}
+
+/**
+ * Function to merge the sets of best simulations of all the processes on the
+ *   master process.
+ *
+ * \return 1 on success, 0 if a worker process lost the master process.
+ */
+int
+process_reduce_best (Best * best,
+                     ///< Set of best simulations, merged on the master.
+                     unsigned int nbest)        ///< Number of best simulations.
+{
+#ifndef G_OS_WIN32
+  Best *received;
+  unsigned int i;
+  int ok = 1;
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_reduce_best: start\n");
+#endif
+  if (process->rank)
+    ok = process_write (process->socket[0], best, nbest * sizeof (Best));
+  else
+    {
+      received = (Best *) g_malloc (nbest * sizeof (Best));
+      for (i = 1; i < process->nprocesses; ++i)
+        {
+          if (process->socket[i] < 0)
+            continue;
+          if (process_read (process->socket[i], received,
+                            nbest * sizeof (Best)))
+            best_merge (received, best, nbest);
+          else
+            process_lost (i);
+        }
+      g_free (received);
+    }
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_reduce_best: end\n");
+#endif
+  return ok;
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Function to reduce a value to its maximum on all the processes.
+ *
+ * \return 1 on success, 0 if a worker process lost the master process.
+ */
+int
+process_reduce_max (unsigned int *value)        ///< Pointer to the value.
+{
+#ifndef G_OS_WIN32
+  unsigned int i, received;
+  int ok = 1;
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_reduce_max: start\n");
+#endif
+  if (process->rank)
+    ok = process_write (process->socket[0], value, sizeof (unsigned int))
+      && process_read (process->socket[0], value, sizeof (unsigned int));
+  else
+    {
+      for (i = 1; i < process->nprocesses; ++i)
+        {
+          if (process->socket[i] < 0)
+            continue;
+          if (process_read (process->socket[i], &received,
+                            sizeof (unsigned int)))
+            *value = MAX (*value, received);
+          else
+            process_lost (i);
+        }
+      for (i = 1; i < process->nprocesses; ++i)
+        if (process->socket[i] >= 0
+            && !process_write (process->socket[i], value,
+                               sizeof (unsigned int)))
+          process_lost (i);
+    }
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_reduce_max: end\n");
+#endif
+  return ok;
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Function to reduce an array of values to their maxima in all the processes.
+ *
+ * \return 1 on success, 0 if a worker process lost the master process.
+ */
+int
+process_reduce_max_array (double *value,        ///< Array of values.
+                          unsigned int n)       ///< Number of values.
+{
+#ifndef G_OS_WIN32
+  double *received;
+  unsigned int i, j;
+  int ok = 1;
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_reduce_max_array: start\n");
+#endif
+  if (process->rank)
+    ok = process_write (process->socket[0], value, n * sizeof (double))
+      && process_read (process->socket[0], value, n * sizeof (double));
+  else
+    {
+      received = (double *) g_malloc (n * sizeof (double));
+      for (i = 1; i < process->nprocesses; ++i)
+        {
+          if (process->socket[i] < 0)
+            continue;
+          if (process_read (process->socket[i], received, n * sizeof (double)))
+            for (j = 0; j < n; ++j)
+              value[j] = MAX (value[j], received[j]);
+          else
+            process_lost (i);
+        }
+      g_free (received);
+      for (i = 1; i < process->nprocesses; ++i)
+        if (process->socket[i] >= 0
+            && !process_write (process->socket[i], value, n * sizeof (double)))
+          process_lost (i);
+    }
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_reduce_max_array: end\n");
+#endif
+  return ok;
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Function to broadcast data from the master process to the worker processes.
+ *
+ * \return 1 on success, 0 if a worker process lost the master process.
+ */
+int
+process_broadcast (void *data,  ///< Data.
+                   size_t size) ///< Data size in bytes.
+{
+#ifndef G_OS_WIN32
+  unsigned int i;
+  int ok = 1;
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_broadcast: start\n");
+#endif
+  if (process->rank)
+    ok = process_read (process->socket[0], data, size);
+  else
+    for (i = 1; i < process->nprocesses; ++i)
+      if (process->socket[i] >= 0
+          && !process_write (process->socket[i], data, size))
+        process_lost (i);
+#if DEBUG_PROCESS
+  fprintf (stderr, "process_broadcast: end\n");
+#endif
+  return ok;
+#else
+  return 1;
+#endif
+}
@@ -0,0 +1,66 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file process.h
+ * \brief Header file to define the local worker processes communicating over
+ *   UNIX sockets without MPI.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#ifndef PROCESS__H
+#define PROCESS__H 1
+
+/**
+ * \struct Process
+ * \brief Struct to define the local worker processes.
+ */
+typedef struct
+{
+  GPid *pid;                    ///< Array of worker process identifiers.
+  int *socket;
+  ///< Array of sockets connected to the worker processes on the master
+  ///< process or socket connected to the master process on the workers.
+  unsigned int nprocesses;      ///< Number of processes.
+  int rank;                     ///< Number of process.
+} Process;
+
+extern Process process[1];
+
+// Public functions
+int process_open (unsigned int nprocesses);
+void process_close ();
+int process_reduce_best (Best * best, unsigned int nbest);
+int process_reduce_max (unsigned int *value);
+int process_reduce_max_array (double *value, unsigned int n);
+int process_broadcast (void *data, size_t size);
+
+#endif
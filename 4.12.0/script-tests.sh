@@ -433,6 +433,36 @@
 ./mpcotoolbin ../tests/testSphere/test-sw-50-50-1-14.xml result-sw-50-50-1-14 variables-sw-50-50-1-14
 ./mpcotoolbin ../tests/testSphere/test-sw-cd-10-10-1-600-0.1-1-14.xml result-sw-cd-10-10-1-600-0.1-1-14 variables-sw-cd-10-10-1-600-0.1-1-14
 ./mpcotoolbin ../tests/testSphere/test-sw-cd-40-40-1-225-0.01-1-14.xml result-sw-cd-40-40-1-225-0.01-1-14 variables-sw-cd-40-40-1-225-0.01-1-14
+./mpcotoolbin -seed 777 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-777 variables-surrogate-400-25-10-0.5-14-777
+./mpcotoolbin -seed 7077 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-7077 variables-surrogate-400-25-10-0.5-14-7077
+./mpcotoolbin -seed 7707 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-7707 variables-surrogate-400-25-10-0.5-14-7707
+./mpcotoolbin -seed 7770 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-7770 variables-surrogate-400-25-10-0.5-14-7770
+./mpcotoolbin -seed 70077 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-70077 variables-surrogate-400-25-10-0.5-14-70077
+./mpcotoolbin -seed 70707 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-70707 variables-surrogate-400-25-10-0.5-14-70707
+./mpcotoolbin -seed 70770 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-70770 variables-surrogate-400-25-10-0.5-14-70770
+./mpcotoolbin -seed 77007 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-77007 variables-surrogate-400-25-10-0.5-14-77007
+./mpcotoolbin -seed 77070 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-77070 variables-surrogate-400-25-10-0.5-14-77070
+./mpcotoolbin -seed 77700 ../tests/testSphere/test-surrogate-400-25-10-0.5-14.xml result-surrogate-400-25-10-0.5-14-77700 variables-surrogate-400-25-10-0.5-14-77700
+./mpcotoolbin -seed 777 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-777 variables-sobol-2500-1-14-777
+./mpcotoolbin -seed 7077 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-7077 variables-sobol-2500-1-14-7077
+./mpcotoolbin -seed 7707 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-7707 variables-sobol-2500-1-14-7707
+./mpcotoolbin -seed 7770 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-7770 variables-sobol-2500-1-14-7770
+./mpcotoolbin -seed 70077 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-70077 variables-sobol-2500-1-14-70077
+./mpcotoolbin -seed 70707 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-70707 variables-sobol-2500-1-14-70707
+./mpcotoolbin -seed 70770 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-70770 variables-sobol-2500-1-14-70770
+./mpcotoolbin -seed 77007 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-77007 variables-sobol-2500-1-14-77007
+./mpcotoolbin -seed 77070 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-77070 variables-sobol-2500-1-14-77070
+./mpcotoolbin -seed 77700 ../tests/testSphere/test-sobol-2500-1-14.xml result-sobol-2500-1-14-77700 variables-sobol-2500-1-14-77700
+./mpcotoolbin -seed 777 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-777 variables-latin-2500-1-14-777
+./mpcotoolbin -seed 7077 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-7077 variables-latin-2500-1-14-7077
+./mpcotoolbin -seed 7707 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-7707 variables-latin-2500-1-14-7707
+./mpcotoolbin -seed 7770 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-7770 variables-latin-2500-1-14-7770
+./mpcotoolbin -seed 70077 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-70077 variables-latin-2500-1-14-70077
+./mpcotoolbin -seed 70707 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-70707 variables-latin-2500-1-14-70707
+./mpcotoolbin -seed 70770 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-70770 variables-latin-2500-1-14-70770
+./mpcotoolbin -seed 77007 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-77007 variables-latin-2500-1-14-77007
+./mpcotoolbin -seed 77070 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-77070 variables-latin-2500-1-14-77070
+./mpcotoolbin -seed 77700 ../tests/testSphere/test-latin-2500-1-14.xml result-latin-2500-1-14-77700 variables-latin-2500-1-14-77700
 ./mpcotoolbin -seed 777 ../tests/testAckley/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-777 variables-ge-100-33-0-0-0.75-32-14-777
 ./mpcotoolbin -seed 7077 ../tests/testAckley/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-7077 variables-ge-100-33-0-0-0.75-32-14-7077
 ./mpcotoolbin -seed 7707 ../tests/testAckley/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-7707 variables-ge-100-33-0-0-0.75-32-14-7707
@@ -807,6 +837,16 @@
 ./mpcotoolbin ../tests/testAckley/test-sw-50-50-1-14.xml result-sw-50-50-1-14 variables-sw-50-50-1-14
 ./mpcotoolbin ../tests/testAckley/test-sw-cd-10-10-1-600-0.1-1-14.xml result-sw-cd-10-10-1-600-0.1-1-14 variables-sw-cd-10-10-1-600-0.1-1-14
 ./mpcotoolbin ../tests/testAckley/test-sw-cd-40-40-1-225-0.01-1-14.xml result-sw-cd-40-40-1-225-0.01-1-14 variables-sw-cd-40-40-1-225-0.01-1-14
+./mpcotoolbin -seed 777 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-777 variables-cmaes-6-60-2-14-777
+./mpcotoolbin -seed 7077 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-7077 variables-cmaes-6-60-2-14-7077
+./mpcotoolbin -seed 7707 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-7707 variables-cmaes-6-60-2-14-7707
+./mpcotoolbin -seed 7770 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-7770 variables-cmaes-6-60-2-14-7770
+./mpcotoolbin -seed 70077 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-70077 variables-cmaes-6-60-2-14-70077
+./mpcotoolbin -seed 70707 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-70707 variables-cmaes-6-60-2-14-70707
+./mpcotoolbin -seed 70770 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-70770 variables-cmaes-6-60-2-14-70770
+./mpcotoolbin -seed 77007 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-77007 variables-cmaes-6-60-2-14-77007
+./mpcotoolbin -seed 77070 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-77070 variables-cmaes-6-60-2-14-77070
+./mpcotoolbin -seed 77700 ../tests/testAckley/test-cmaes-6-60-2-14.xml result-cmaes-6-60-2-14-77700 variables-cmaes-6-60-2-14-77700
 ./mpcotoolbin -seed 777 ../tests/testBooth/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-777 variables-ge-100-33-0-0-0.75-32-14-777
 ./mpcotoolbin -seed 7077 ../tests/testBooth/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-7077 variables-ge-100-33-0-0-0.75-32-14-7077
 ./mpcotoolbin -seed 7707 ../tests/testBooth/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-7707 variables-ge-100-33-0-0-0.75-32-14-7707
@@ -1555,6 +1595,66 @@
 ./mpcotoolbin ../tests/testRosenbrock/test-sw-50-50-1-14.xml result-sw-50-50-1-14 variables-sw-50-50-1-14
 ./mpcotoolbin ../tests/testRosenbrock/test-sw-cd-10-10-1-600-0.1-1-14.xml result-sw-cd-10-10-1-600-0.1-1-14 variables-sw-cd-10-10-1-600-0.1-1-14
 ./mpcotoolbin ../tests/testRosenbrock/test-sw-cd-40-40-1-225-0.01-1-14.xml result-sw-cd-40-40-1-225-0.01-1-14 variables-sw-cd-40-40-1-225-0.01-1-14
+./mpcotoolbin -seed 777 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-777 variables-surrogate-100-25-10-0.5-14-777
+./mpcotoolbin -seed 7077 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-7077 variables-surrogate-100-25-10-0.5-14-7077
+./mpcotoolbin -seed 7707 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-7707 variables-surrogate-100-25-10-0.5-14-7707
+./mpcotoolbin -seed 7770 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-7770 variables-surrogate-100-25-10-0.5-14-7770
+./mpcotoolbin -seed 70077 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-70077 variables-surrogate-100-25-10-0.5-14-70077
+./mpcotoolbin -seed 70707 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-70707 variables-surrogate-100-25-10-0.5-14-70707
+./mpcotoolbin -seed 70770 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-70770 variables-surrogate-100-25-10-0.5-14-70770
+./mpcotoolbin -seed 77007 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-77007 variables-surrogate-100-25-10-0.5-14-77007
+./mpcotoolbin -seed 77070 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-77070 variables-surrogate-100-25-10-0.5-14-77070
+./mpcotoolbin -seed 77700 ../tests/testRosenbrock/test-surrogate-100-25-10-0.5-14.xml result-surrogate-100-25-10-0.5-14-77700 variables-surrogate-100-25-10-0.5-14-77700
+./mpcotoolbin -seed 777 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-777 variables-mc-sx-100-1-800-1-0.1-14-777
+./mpcotoolbin -seed 7077 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-7077 variables-mc-sx-100-1-800-1-0.1-14-7077
+./mpcotoolbin -seed 7707 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-7707 variables-mc-sx-100-1-800-1-0.1-14-7707
+./mpcotoolbin -seed 7770 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-7770 variables-mc-sx-100-1-800-1-0.1-14-7770
+./mpcotoolbin -seed 70077 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-70077 variables-mc-sx-100-1-800-1-0.1-14-70077
+./mpcotoolbin -seed 70707 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-70707 variables-mc-sx-100-1-800-1-0.1-14-70707
+./mpcotoolbin -seed 70770 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-70770 variables-mc-sx-100-1-800-1-0.1-14-70770
+./mpcotoolbin -seed 77007 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-77007 variables-mc-sx-100-1-800-1-0.1-14-77007
+./mpcotoolbin -seed 77070 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-77070 variables-mc-sx-100-1-800-1-0.1-14-77070
+./mpcotoolbin -seed 77700 ../tests/testRosenbrock/test-mc-sx-100-1-800-1-0.1-14.xml result-mc-sx-100-1-800-1-0.1-14-77700 variables-mc-sx-100-1-800-1-0.1-14-77700
+./mpcotoolbin -seed 777 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-777 variables-mc-sx-100-1-400-2-0.1-14-777
+./mpcotoolbin -seed 7077 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-7077 variables-mc-sx-100-1-400-2-0.1-14-7077
+./mpcotoolbin -seed 7707 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-7707 variables-mc-sx-100-1-400-2-0.1-14-7707
+./mpcotoolbin -seed 7770 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-7770 variables-mc-sx-100-1-400-2-0.1-14-7770
+./mpcotoolbin -seed 70077 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-70077 variables-mc-sx-100-1-400-2-0.1-14-70077
+./mpcotoolbin -seed 70707 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-70707 variables-mc-sx-100-1-400-2-0.1-14-70707
+./mpcotoolbin -seed 70770 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-70770 variables-mc-sx-100-1-400-2-0.1-14-70770
+./mpcotoolbin -seed 77007 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-77007 variables-mc-sx-100-1-400-2-0.1-14-77007
+./mpcotoolbin -seed 77070 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-77070 variables-mc-sx-100-1-400-2-0.1-14-77070
+./mpcotoolbin -seed 77700 ../tests/testRosenbrock/test-mc-sx-100-1-400-2-0.1-14.xml result-mc-sx-100-1-400-2-0.1-14-77700 variables-mc-sx-100-1-400-2-0.1-14-77700
+./mpcotoolbin -seed 777 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-777 variables-cmaes-6-416-0-14-777
+./mpcotoolbin -seed 7077 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-7077 variables-cmaes-6-416-0-14-7077
+./mpcotoolbin -seed 7707 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-7707 variables-cmaes-6-416-0-14-7707
+./mpcotoolbin -seed 7770 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-7770 variables-cmaes-6-416-0-14-7770
+./mpcotoolbin -seed 70077 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-70077 variables-cmaes-6-416-0-14-70077
+./mpcotoolbin -seed 70707 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-70707 variables-cmaes-6-416-0-14-70707
+./mpcotoolbin -seed 70770 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-70770 variables-cmaes-6-416-0-14-70770
+./mpcotoolbin -seed 77007 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-77007 variables-cmaes-6-416-0-14-77007
+./mpcotoolbin -seed 77070 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-77070 variables-cmaes-6-416-0-14-77070
+./mpcotoolbin -seed 77700 ../tests/testRosenbrock/test-cmaes-6-416-0-14.xml result-cmaes-6-416-0-14-77700 variables-cmaes-6-416-0-14-77700
+./mpcotoolbin -seed 777 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-777 variables-sobol-100-25-10-0.1-14-777
+./mpcotoolbin -seed 7077 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-7077 variables-sobol-100-25-10-0.1-14-7077
+./mpcotoolbin -seed 7707 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-7707 variables-sobol-100-25-10-0.1-14-7707
+./mpcotoolbin -seed 7770 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-7770 variables-sobol-100-25-10-0.1-14-7770
+./mpcotoolbin -seed 70077 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-70077 variables-sobol-100-25-10-0.1-14-70077
+./mpcotoolbin -seed 70707 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-70707 variables-sobol-100-25-10-0.1-14-70707
+./mpcotoolbin -seed 70770 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-70770 variables-sobol-100-25-10-0.1-14-70770
+./mpcotoolbin -seed 77007 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-77007 variables-sobol-100-25-10-0.1-14-77007
+./mpcotoolbin -seed 77070 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-77070 variables-sobol-100-25-10-0.1-14-77070
+./mpcotoolbin -seed 77700 ../tests/testRosenbrock/test-sobol-100-25-10-0.1-14.xml result-sobol-100-25-10-0.1-14-77700 variables-sobol-100-25-10-0.1-14-77700
+./mpcotoolbin -seed 777 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-777 variables-latin-100-25-10-0.1-14-777
+./mpcotoolbin -seed 7077 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-7077 variables-latin-100-25-10-0.1-14-7077
+./mpcotoolbin -seed 7707 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-7707 variables-latin-100-25-10-0.1-14-7707
+./mpcotoolbin -seed 7770 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-7770 variables-latin-100-25-10-0.1-14-7770
+./mpcotoolbin -seed 70077 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-70077 variables-latin-100-25-10-0.1-14-70077
+./mpcotoolbin -seed 70707 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-70707 variables-latin-100-25-10-0.1-14-70707
+./mpcotoolbin -seed 70770 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-70770 variables-latin-100-25-10-0.1-14-70770
+./mpcotoolbin -seed 77007 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-77007 variables-latin-100-25-10-0.1-14-77007
+./mpcotoolbin -seed 77070 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-77070 variables-latin-100-25-10-0.1-14-77070
+./mpcotoolbin -seed 77700 ../tests/testRosenbrock/test-latin-100-25-10-0.1-14.xml result-latin-100-25-10-0.1-14-77700 variables-latin-100-25-10-0.1-14-77700
 ./mpcotoolbin -seed 777 ../tests/testEasom/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-777 variables-ge-100-33-0-0-0.75-32-14-777
 ./mpcotoolbin -seed 7077 ../tests/testEasom/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-7077 variables-ge-100-33-0-0-0.75-32-14-7077
 ./mpcotoolbin -seed 7707 ../tests/testEasom/test-ge-100-33-0-0-0.75-32-14.xml result-ge-100-33-0-0-0.75-32-14-7707 variables-ge-100-33-0-0-0.75-32-14-7707
@@ -2739,6 +2839,36 @@ cd ../tests
 ./process testSphere/variables-sw-50-50-1-14 testSphere/v-sw-50-50-1-14 
 ./process testSphere/variables-sw-cd-10-10-1-600-0.1-1-14 testSphere/v-sw-cd-10-10-1-600-0.1-1-14 
 ./process testSphere/variables-sw-cd-40-40-1-225-0.01-1-14 testSphere/v-sw-cd-40-40-1-225-0.01-1-14 
+./process testSphere/variables-surrogate-400-25-10-0.5-14-777 testSphere/v-surrogate-400-25-10-0.5-14-777
+./process testSphere/variables-surrogate-400-25-10-0.5-14-7077 testSphere/v-surrogate-400-25-10-0.5-14-7077
+./process testSphere/variables-surrogate-400-25-10-0.5-14-7707 testSphere/v-surrogate-400-25-10-0.5-14-7707
+./process testSphere/variables-surrogate-400-25-10-0.5-14-7770 testSphere/v-surrogate-400-25-10-0.5-14-7770
+./process testSphere/variables-surrogate-400-25-10-0.5-14-70077 testSphere/v-surrogate-400-25-10-0.5-14-70077
+./process testSphere/variables-surrogate-400-25-10-0.5-14-70707 testSphere/v-surrogate-400-25-10-0.5-14-70707
+./process testSphere/variables-surrogate-400-25-10-0.5-14-70770 testSphere/v-surrogate-400-25-10-0.5-14-70770
+./process testSphere/variables-surrogate-400-25-10-0.5-14-77007 testSphere/v-surrogate-400-25-10-0.5-14-77007
+./process testSphere/variables-surrogate-400-25-10-0.5-14-77070 testSphere/v-surrogate-400-25-10-0.5-14-77070
+./process testSphere/variables-surrogate-400-25-10-0.5-14-77700 testSphere/v-surrogate-400-25-10-0.5-14-77700
+./process testSphere/variables-sobol-2500-1-14-777 testSphere/v-sobol-2500-1-14-777
+./process testSphere/variables-sobol-2500-1-14-7077 testSphere/v-sobol-2500-1-14-7077
+./process testSphere/variables-sobol-2500-1-14-7707 testSphere/v-sobol-2500-1-14-7707
+./process testSphere/variables-sobol-2500-1-14-7770 testSphere/v-sobol-2500-1-14-7770
+./process testSphere/variables-sobol-2500-1-14-70077 testSphere/v-sobol-2500-1-14-70077
+./process testSphere/variables-sobol-2500-1-14-70707 testSphere/v-sobol-2500-1-14-70707
+./process testSphere/variables-sobol-2500-1-14-70770 testSphere/v-sobol-2500-1-14-70770
+./process testSphere/variables-sobol-2500-1-14-77007 testSphere/v-sobol-2500-1-14-77007
+./process testSphere/variables-sobol-2500-1-14-77070 testSphere/v-sobol-2500-1-14-77070
+./process testSphere/variables-sobol-2500-1-14-77700 testSphere/v-sobol-2500-1-14-77700
+./process testSphere/variables-latin-2500-1-14-777 testSphere/v-latin-2500-1-14-777
+./process testSphere/variables-latin-2500-1-14-7077 testSphere/v-latin-2500-1-14-7077
+./process testSphere/variables-latin-2500-1-14-7707 testSphere/v-latin-2500-1-14-7707
+./process testSphere/variables-latin-2500-1-14-7770 testSphere/v-latin-2500-1-14-7770
+./process testSphere/variables-latin-2500-1-14-70077 testSphere/v-latin-2500-1-14-70077
+./process testSphere/variables-latin-2500-1-14-70707 testSphere/v-latin-2500-1-14-70707
+./process testSphere/variables-latin-2500-1-14-70770 testSphere/v-latin-2500-1-14-70770
+./process testSphere/variables-latin-2500-1-14-77007 testSphere/v-latin-2500-1-14-77007
+./process testSphere/variables-latin-2500-1-14-77070 testSphere/v-latin-2500-1-14-77070
+./process testSphere/variables-latin-2500-1-14-77700 testSphere/v-latin-2500-1-14-77700
 ./process testAckley/variables-ge-100-33-0-0-0.75-32-14-777 testAckley/v-ge-100-33-0-0-0.75-32-14-777 
 ./process testAckley/variables-ge-100-33-0-0-0.75-32-14-7077 testAckley/v-ge-100-33-0-0-0.75-32-14-7077 
 ./process testAckley/variables-ge-100-33-0-0-0.75-32-14-7707 testAckley/v-ge-100-33-0-0-0.75-32-14-7707 
@@ -3113,6 +3243,16 @@ cd ../tests
 ./process testAckley/variables-sw-50-50-1-14 testAckley/v-sw-50-50-1-14 
 ./process testAckley/variables-sw-cd-10-10-1-600-0.1-1-14 testAckley/v-sw-cd-10-10-1-600-0.1-1-14 
 ./process testAckley/variables-sw-cd-40-40-1-225-0.01-1-14 testAckley/v-sw-cd-40-40-1-225-0.01-1-14 
+./process testAckley/variables-cmaes-6-60-2-14-777 testAckley/v-cmaes-6-60-2-14-777 
+./process testAckley/variables-cmaes-6-60-2-14-7077 testAckley/v-cmaes-6-60-2-14-7077 
+./process testAckley/variables-cmaes-6-60-2-14-7707 testAckley/v-cmaes-6-60-2-14-7707 
+./process testAckley/variables-cmaes-6-60-2-14-7770 testAckley/v-cmaes-6-60-2-14-7770 
+./process testAckley/variables-cmaes-6-60-2-14-70077 testAckley/v-cmaes-6-60-2-14-70077 
+./process testAckley/variables-cmaes-6-60-2-14-70707 testAckley/v-cmaes-6-60-2-14-70707 
+./process testAckley/variables-cmaes-6-60-2-14-70770 testAckley/v-cmaes-6-60-2-14-70770 
+./process testAckley/variables-cmaes-6-60-2-14-77007 testAckley/v-cmaes-6-60-2-14-77007 
+./process testAckley/variables-cmaes-6-60-2-14-77070 testAckley/v-cmaes-6-60-2-14-77070 
+./process testAckley/variables-cmaes-6-60-2-14-77700 testAckley/v-cmaes-6-60-2-14-77700 
 ./process testBooth/variables-ge-100-33-0-0-0.75-32-14-777 testBooth/v-ge-100-33-0-0-0.75-32-14-777 1 3
 ./process testBooth/variables-ge-100-33-0-0-0.75-32-14-7077 testBooth/v-ge-100-33-0-0-0.75-32-14-7077 1 3
 ./process testBooth/variables-ge-100-33-0-0-0.75-32-14-7707 testBooth/v-ge-100-33-0-0-0.75-32-14-7707 1 3
@@ -3861,6 +4001,66 @@ cd ../tests
 ./process testRosenbrock/variables-sw-50-50-1-14 testRosenbrock/v-sw-50-50-1-14 1 1
 ./process testRosenbrock/variables-sw-cd-10-10-1-600-0.1-1-14 testRosenbrock/v-sw-cd-10-10-1-600-0.1-1-14 1 1
 ./process testRosenbrock/variables-sw-cd-40-40-1-225-0.01-1-14 testRosenbrock/v-sw-cd-40-40-1-225-0.01-1-14 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-777 testRosenbrock/v-surrogate-100-25-10-0.5-14-777 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-7077 testRosenbrock/v-surrogate-100-25-10-0.5-14-7077 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-7707 testRosenbrock/v-surrogate-100-25-10-0.5-14-7707 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-7770 testRosenbrock/v-surrogate-100-25-10-0.5-14-7770 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-70077 testRosenbrock/v-surrogate-100-25-10-0.5-14-70077 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-70707 testRosenbrock/v-surrogate-100-25-10-0.5-14-70707 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-70770 testRosenbrock/v-surrogate-100-25-10-0.5-14-70770 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-77007 testRosenbrock/v-surrogate-100-25-10-0.5-14-77007 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-77070 testRosenbrock/v-surrogate-100-25-10-0.5-14-77070 1 1
+./process testRosenbrock/variables-surrogate-100-25-10-0.5-14-77700 testRosenbrock/v-surrogate-100-25-10-0.5-14-77700 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-777 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-777 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-7077 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-7077 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-7707 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-7707 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-7770 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-7770 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-70077 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-70077 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-70707 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-70707 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-70770 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-70770 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-77007 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-77007 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-77070 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-77070 1 1
+./process testRosenbrock/variables-mc-sx-100-1-800-1-0.1-14-77700 testRosenbrock/v-mc-sx-100-1-800-1-0.1-14-77700 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-777 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-777 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-7077 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-7077 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-7707 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-7707 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-7770 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-7770 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-70077 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-70077 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-70707 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-70707 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-70770 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-70770 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-77007 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-77007 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-77070 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-77070 1 1
+./process testRosenbrock/variables-mc-sx-100-1-400-2-0.1-14-77700 testRosenbrock/v-mc-sx-100-1-400-2-0.1-14-77700 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-777 testRosenbrock/v-cmaes-6-416-0-14-777 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-7077 testRosenbrock/v-cmaes-6-416-0-14-7077 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-7707 testRosenbrock/v-cmaes-6-416-0-14-7707 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-7770 testRosenbrock/v-cmaes-6-416-0-14-7770 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-70077 testRosenbrock/v-cmaes-6-416-0-14-70077 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-70707 testRosenbrock/v-cmaes-6-416-0-14-70707 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-70770 testRosenbrock/v-cmaes-6-416-0-14-70770 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-77007 testRosenbrock/v-cmaes-6-416-0-14-77007 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-77070 testRosenbrock/v-cmaes-6-416-0-14-77070 1 1
+./process testRosenbrock/variables-cmaes-6-416-0-14-77700 testRosenbrock/v-cmaes-6-416-0-14-77700 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-777 testRosenbrock/v-sobol-100-25-10-0.1-14-777 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-7077 testRosenbrock/v-sobol-100-25-10-0.1-14-7077 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-7707 testRosenbrock/v-sobol-100-25-10-0.1-14-7707 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-7770 testRosenbrock/v-sobol-100-25-10-0.1-14-7770 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-70077 testRosenbrock/v-sobol-100-25-10-0.1-14-70077 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-70707 testRosenbrock/v-sobol-100-25-10-0.1-14-70707 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-70770 testRosenbrock/v-sobol-100-25-10-0.1-14-70770 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-77007 testRosenbrock/v-sobol-100-25-10-0.1-14-77007 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-77070 testRosenbrock/v-sobol-100-25-10-0.1-14-77070 1 1
+./process testRosenbrock/variables-sobol-100-25-10-0.1-14-77700 testRosenbrock/v-sobol-100-25-10-0.1-14-77700 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-777 testRosenbrock/v-latin-100-25-10-0.1-14-777 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-7077 testRosenbrock/v-latin-100-25-10-0.1-14-7077 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-7707 testRosenbrock/v-latin-100-25-10-0.1-14-7707 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-7770 testRosenbrock/v-latin-100-25-10-0.1-14-7770 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-70077 testRosenbrock/v-latin-100-25-10-0.1-14-70077 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-70707 testRosenbrock/v-latin-100-25-10-0.1-14-70707 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-70770 testRosenbrock/v-latin-100-25-10-0.1-14-70770 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-77007 testRosenbrock/v-latin-100-25-10-0.1-14-77007 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-77070 testRosenbrock/v-latin-100-25-10-0.1-14-77070 1 1
+./process testRosenbrock/variables-latin-100-25-10-0.1-14-77700 testRosenbrock/v-latin-100-25-10-0.1-14-77700 1 1
 ./process testEasom/variables-ge-100-33-0-0-0.75-32-14-777 testEasom/v-ge-100-33-0-0-0.75-32-14-777 0
 ./process testEasom/variables-ge-100-33-0-0-0.75-32-14-7077 testEasom/v-ge-100-33-0-0-0.75-32-14-7077 0
 ./process testEasom/variables-ge-100-33-0-0-0.75-32-14-7707 testEasom/v-ge-100-33-0-0-0.75-32-14-7707 0
@@ -4650,6 +4850,9 @@ cd ../tests
 ./process2 Sphere sw-50-50-1-14 1 >> result
 ./process2 Sphere sw-cd-10-10-1-600-0.1-1-14 1 >> result
 ./process2 Sphere sw-cd-40-40-1-225-0.01-1-14 1 >> result
+./process2 Sphere surrogate-400-25-10-0.5-14-* 10 >> result
+./process2 Sphere sobol-2500-1-14-* 10 >> result
+./process2 Sphere latin-2500-1-14-* 10 >> result
 ./process2 Ackley ge-100-33-0-0-0.75-32-14-* 10 >> result
 ./process2 Ackley ge-100-33-0-0.75-0-32-14-* 10 >> result
 ./process2 Ackley ge-100-33-0.25-0.25-0.25-32-14-* 10 >> result
@@ -4691,6 +4894,7 @@ cd ../tests
 ./process2 Ackley sw-50-50-1-14 1 >> result
 ./process2 Ackley sw-cd-10-10-1-600-0.1-1-14 1 >> result
 ./process2 Ackley sw-cd-40-40-1-225-0.01-1-14 1 >> result
+./process2 Ackley cmaes-6-60-2-14-* 10 >> result
 ./process2 Booth ge-100-33-0-0-0.75-32-14-* 10 >> result
 ./process2 Booth ge-100-33-0-0.75-0-32-14-* 10 >> result
 ./process2 Booth ge-100-33-0.25-0.25-0.25-32-14-* 10 >> result
@@ -4773,6 +4977,12 @@ cd ../tests
 ./process2 Rosenbrock sw-50-50-1-14 1 >> result
 ./process2 Rosenbrock sw-cd-10-10-1-600-0.1-1-14 1 >> result
 ./process2 Rosenbrock sw-cd-40-40-1-225-0.01-1-14 1 >> result
+./process2 Rosenbrock surrogate-100-25-10-0.5-14-* 10 >> result
+./process2 Rosenbrock mc-sx-100-1-800-1-0.1-14-* 10 >> result
+./process2 Rosenbrock mc-sx-100-1-400-2-0.1-14-* 10 >> result
+./process2 Rosenbrock cmaes-6-416-0-14-* 10 >> result
+./process2 Rosenbrock sobol-100-25-10-0.1-14-* 10 >> result
+./process2 Rosenbrock latin-100-25-10-0.1-14-* 10 >> result
 ./process2 Easom ge-100-33-0-0-0.75-32-14-* 10 >> result
 ./process2 Easom ge-100-33-0-0.75-0-32-14-* 10 >> result
 ./process2 Easom ge-100-33-0.25-0.25-0.25-32-14-* 10 >> result
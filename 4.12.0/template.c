@@ -0,0 +1,240 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+        this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file template.c
+ * \brief Source file to define the precompiled templates of input files.
+ *
+ * The templates are split once in literal text segments and \@variableN\@ or
+ * \@valueN\@ slots, and they are rendered in a single pass on a per-thread
+ * reusable buffer.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <stdio.h>
+#include <string.h>
+#include <libxml/parser.h>
+#include <glib.h>
+#include <json-glib/json-glib.h>
+#include "variable.h"
+#include "template.h"
+
+#define DEBUG_TEMPLATE 0        ///< Macro to debug template functions.
+
+/**
+ * Function to free the per-thread render buffers.
+ */
+static void
+template_buffer_free (gpointer data)    ///< Array of GString buffers.
+{
+  GString **buffer = (GString **) data;
+  unsigned int i;
+  for (i = 0; i < MAX_NINPUTS; ++i)
+    if (buffer[i])
+      g_string_free (buffer[i], TRUE);
+  g_free (buffer);
+}
+
+static GPrivate template_buffer = G_PRIVATE_INIT (template_buffer_free);
+///< Per-thread render buffers, one for every input file.
+
+/**
+ * Function to add a segment to a template.
+ */
+static inline void
+template_add (Template * template,      ///< Template struct.
+              const char *text,        ///< Literal text.
+              size_t length,   ///< Literal text length.
+              unsigned int variable,   ///< Variable number.
+              unsigned int type)       ///< Segment type.
+{
+  TemplateSegment *segment;
+  if (type == TEMPLATE_SEGMENT_TEXT && !length)
+    return;
+  template->segment = (TemplateSegment *)
+    g_realloc (template->segment,
+               (template->nsegments + 1) * sizeof (TemplateSegment));
+  segment = template->segment + template->nsegments;
+  segment->text = text;
+  segment->length = length;
+  segment->variable = variable;
+  segment->type = type;
+  template->length += length;
+  ++template->nsegments;
+}
+
+/**
+ * Function to parse a \@variableN\@ or \@valueN\@ slot.
+ *
+ * \return slot length or 0 if it is not a slot.
+ */
+static inline size_t
+template_slot (const char *text,        ///< Text starting with \@.
+               const char *end, ///< End of the template.
+               unsigned int nvariables, ///< Number of variables.
+               unsigned int *variable,  ///< Pointer to the variable number.
+               unsigned int *type)      ///< Pointer to the segment type.
+{
+  const char *c;
+  unsigned int n;
+  c = text + 1;
+  if ((size_t) (end - c) > 8 && !strncmp (c, "variable", 8))
+    {
+      *type = TEMPLATE_SEGMENT_VARIABLE;
+      c += 8;
+    }
+  else if ((size_t) (end - c) > 5 && !strncmp (c, "value", 5))
+    {
+      *type = TEMPLATE_SEGMENT_VALUE;
+      c += 5;
+    }
+  else
+    return 0;
+  if (*c < '1' || *c > '9')
+    return 0;
+  for (n = 0; c < end && *c >= '0' && *c <= '9'; ++c)
+    {
+      n = 10 * n + (*c - '0');
+      if (n > nvariables)
+        return 0;
+    }
+  if (c == end || *c != '@')
+    return 0;
+  *variable = n - 1;
+  return c + 1 - text;
+}
+
+/**
+ * Function to precompile a template.
+ */
+void
+template_new (Template * template,     ///< Template struct.
+              const char *content,     ///< Template contents.
+              size_t length,   ///< Template contents length.
+              unsigned int nvariables) ///< Number of variables.
+{
+  const char *c, *text, *end;
+  size_t n;
+  unsigned int variable, type;
+#if DEBUG_TEMPLATE
+  fprintf (stderr, "template_new: start\n");
+#endif
+  template->segment = NULL;
+  template->length = 0;
+  template->nsegments = 0;
+  end = content + length;
+  for (text = c = content; c < end;)
+    {
+      c = (const char *) memchr (c, '@', end - c);
+      if (!c)
+        break;
+      n = template_slot (c, end, nvariables, &variable, &type);
+      if (!n)
+        {
+          ++c;
+          continue;
+        }
+      template_add (template, text, c - text, 0, TEMPLATE_SEGMENT_TEXT);
+      template_add (template, NULL, 0, variable, type);
+      text = c += n;
+    }
+  template_add (template, text, end - text, 0, TEMPLATE_SEGMENT_TEXT);
+#if DEBUG_TEMPLATE
+  fprintf (stderr, "template_new: nsegments=%u\n", template->nsegments);
+  fprintf (stderr, "template_new: end\n");
+#endif
+}
+
+/**
+ * Function to free the memory of a precompiled template.
+ */
+void
+template_free (Template * template)    ///< Template struct.
+{
+  g_free (template->segment);
+  template->segment = NULL;
+  template->nsegments = 0;
+}
+
+/**
+ * Function to render a precompiled template.
+ *
+ * \return rendered text, valid in the calling thread until the next render on
+ *   the same buffer.
+ */
+const char *
+template_render (Template * template,  ///< Template struct.
+                 unsigned int buffer,  ///< Number of the per-thread buffer.
+                 char **label, ///< Array of variable names.
+                 double *value,        ///< Array of variable values.
+                 unsigned int *precision,
+                 ///< Array of variable precisions.
+                 size_t *length)       ///< Pointer to the rendered length.
+{
+  char text[32];
+  GString **array, *string;
+  TemplateSegment *segment;
+  unsigned int i;
+  int n;
+
+  // Getting the buffer of the thread
+  array = (GString **) g_private_get (&template_buffer);
+  if (!array)
+    {
+      array = (GString **) g_malloc0 (MAX_NINPUTS * sizeof (GString *));
+      g_private_set (&template_buffer, array);
+    }
+  string = array[buffer];
+  if (!string)
+    string = array[buffer] = g_string_sized_new (template->length + 1024);
+  g_string_truncate (string, 0);
+
+  // Rendering the segments
+  for (i = 0, segment = template->segment; i < template->nsegments;
+       ++i, ++segment)
+    switch (segment->type)
+      {
+      case TEMPLATE_SEGMENT_TEXT:
+        g_string_append_len (string, segment->text, segment->length);
+        break;
+      case TEMPLATE_SEGMENT_VARIABLE:
+        g_string_append (string, label[segment->variable]);
+        break;
+      default:
+        n = snprintf (text, 32, format[precision[segment->variable]],
+                      value[segment->variable]);
+        g_string_append_len (string, text, MIN (n, 31));
+      }
+  *length = string->len;
+  return string->str;
+}
@@ -0,0 +1,83 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file template.h
+ * \brief Header file to define the precompiled templates of input files.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#ifndef TEMPLATE__H
+#define TEMPLATE__H 1
+
+/**
+ * \enum TemplateSegmentType
+ * \brief Enum to define the template segment types.
+ */
+enum TemplateSegmentType
+{
+  TEMPLATE_SEGMENT_TEXT = 0,    ///< Literal text.
+  TEMPLATE_SEGMENT_VARIABLE = 1,        ///< Variable name (\@variableN\@).
+  TEMPLATE_SEGMENT_VALUE = 2    ///< Variable value (\@valueN\@).
+};
+
+/**
+ * \struct TemplateSegment
+ * \brief Struct to define a segment of a precompiled template.
+ */
+typedef struct
+{
+  const char *text;             ///< Literal text.
+  size_t length;                ///< Literal text length.
+  unsigned int variable;        ///< Variable number.
+  unsigned int type;            ///< Segment type.
+} TemplateSegment;
+
+/**
+ * \struct Template
+ * \brief Struct to define a precompiled template of an input file.
+ */
+typedef struct
+{
+  TemplateSegment *segment;     ///< Array of segments.
+  size_t length;                ///< Literal text length.
+  unsigned int nsegments;       ///< Number of segments.
+} Template;
+
+// Public functions
+void template_new (Template * template, const char *content, size_t length,
+                   unsigned int nvariables);
+void template_free (Template * template);
+const char *template_render (Template * template, unsigned int buffer,
+                             char **label, double *value,
+                             unsigned int *precision, size_t *length);
+
+#endif
@@ -39,12 +39,18 @@ OF SUCH DAMAGE.
 #include "config.h"
 #include <stdio.h>
 #include <unistd.h>
+#include <errno.h>
 #include <libxml/parser.h>
 #include <libintl.h>
 #include <glib.h>
 #include <json-glib/json-glib.h>
 #ifdef G_OS_WIN32
 #include <windows.h>
+#else
+#include <spawn.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <sys/wait.h>
 #endif
 #if HAVE_GTK
 #include <gtk/gtk.h>
@@ -59,3 +65,147 @@ GtkWindow *main_window;         ///< Main GtkWindow.
 char *error_message;            ///< Error message.
 void (*show_pending) () = NULL;
 ///< Pointer to the function to show pending events.
+
+#ifndef G_OS_WIN32
+extern char **environ;
+#endif
+
+/**
+ * Function to run a program without a shell and to wait for its end.
+ *
+ * The program is launched with posix_spawn (implemented with vfork or
+ * clone(CLONE_VFORK) by the common C libraries) so no shell is forked and no
+ * command line is parsed. On Windows the wait status of g_spawn_sync is
+ * decoded by g_spawn_check_wait_status, so both platforms return the exit
+ * status of the program.
+ *
+ * \return program exit status on success, -1 on error.
+ */
+int
+tools_spawn (char **argv)
+///< NULL-terminated array with the program path and its arguments.
+{
+  int status;
+#ifdef G_OS_WIN32
+  GError *error = NULL;
+  if (!g_spawn_sync (NULL, argv, NULL, G_SPAWN_DEFAULT, NULL, NULL, NULL,
+                     NULL, &status, &error))
+    {
+      g_error_free (error);
+      return -1;
+    }
+  if (g_spawn_check_wait_status (status, &error))
+    return 0;
+  status = (error->domain == G_SPAWN_EXIT_ERROR) ? error->code : -1;
+  g_error_free (error);
+  return status;
+#else
+  pid_t pid;
+  if (posix_spawn (&pid, argv[0], NULL, NULL, argv, environ))
+    return -1;
+  while (waitpid (pid, &status, 0) == -1)
+    if (errno != EINTR)
+      return -1;
+  if (!WIFEXITED (status))
+    return -1;
+  return WEXITSTATUS (status);
+#endif
+}
+
+/**
+ * Function to run a program without a shell connecting its standard input and
+ *   output to pipes.
+ *
+ * The parent ends of the pipes are not inherited by other spawned programs.
+ *
+ * \return 1 on success, 0 on error.
+ */
+int
+tools_spawn_pipes (char **argv,
+                   ///< NULL-terminated array with the program path and its
+                   ///< arguments.
+                   GPid * pid,  ///< Pointer to the process identifier.
+                   int *fd_in,  ///< Pointer to the program standard input.
+                   int *fd_out) ///< Pointer to the program standard output.
+{
+#ifdef G_OS_WIN32
+  GError *error = NULL;
+  if (!g_spawn_async_with_pipes (NULL, argv, NULL, G_SPAWN_DO_NOT_REAP_CHILD,
+                                 NULL, NULL, pid, fd_in, fd_out, NULL, &error))
+    {
+      g_error_free (error);
+      return 0;
+    }
+  return 1;
+#else
+  posix_spawn_file_actions_t actions;
+  int p_in[2], p_out[2];
+  int ok = 0;
+
+  // Opening the pipes, not inherited by other spawned programs
+  if (pipe2 (p_in, O_CLOEXEC))
+    return 0;
+  if (pipe2 (p_out, O_CLOEXEC))
+    goto exit_in;
+
+  // Launching the program
+  posix_spawn_file_actions_init (&actions);
+  posix_spawn_file_actions_adddup2 (&actions, p_in[0], STDIN_FILENO);
+  posix_spawn_file_actions_adddup2 (&actions, p_out[1], STDOUT_FILENO);
+  posix_spawn_file_actions_addclose (&actions, p_in[0]);
+  posix_spawn_file_actions_addclose (&actions, p_out[1]);
+  if (!posix_spawn (pid, argv[0], &actions, NULL, argv, environ))
+    {
+      *fd_in = p_in[1];
+      *fd_out = p_out[0];
+      ok = 1;
+    }
+  posix_spawn_file_actions_destroy (&actions);
+  close (p_out[1]);
+  if (!ok)
+    close (p_out[0]);
+exit_in:
+  close (p_in[0]);
+  if (!ok)
+    close (p_in[1]);
+  return ok;
+#endif
+}
+
+/**
+ * Function to finish a program launched with tools_spawn_pipes.
+ *
+ * The program is killed if it does not finish in KILL_WAIT_TIME
+ * microseconds after the termination request.
+ */
+void
+tools_kill (GPid pid)           ///< Process identifier.
+{
+#ifdef G_OS_WIN32
+  TerminateProcess (pid, 1);
+  WaitForSingleObject (pid, INFINITE);
+  g_spawn_close_pid (pid);
+#else
+  gint64 t;
+  pid_t r;
+  int status;
+  kill (pid, SIGTERM);
+  t = g_get_monotonic_time () + KILL_WAIT_TIME;
+  do
+    {
+      r = waitpid (pid, &status, WNOHANG);
+      if (r)
+        {
+          if (r > 0 || errno != EINTR)
+            return;
+          continue;
+        }
+      g_usleep (KILL_POLL_TIME);
+    }
+  while (g_get_monotonic_time () < t);
+  kill (pid, SIGKILL);
+  while (waitpid (pid, &status, 0) == -1)
+    if (errno != EINTR)
+      break;
+#endif
+}
@@ -59,4 +59,8 @@ extern GtkWindow *window_parent;
 extern char *error_message;
 extern void (*show_pending) ();
 
+int tools_spawn (char **argv);
+int tools_spawn_pipes (char **argv, GPid * pid, int *fd_in, int *fd_out);
+void tools_kill (GPid pid);
+
 #endif
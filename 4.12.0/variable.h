@@ -44,7 +44,11 @@ enum Algorithm
   ALGORITHM_MONTE_CARLO = 0,    ///< Monte-Carlo algorithm.
   ALGORITHM_SWEEP = 1,          ///< Sweep algorithm.
   ALGORITHM_GENETIC = 2,        ///< Genetic algorithm.
-  ALGORITHM_ORTHOGONAL = 3      ///< Orthogonal sampling algorithm.
+  ALGORITHM_ORTHOGONAL = 3,     ///< Orthogonal sampling algorithm.
+  ALGORITHM_SURROGATE = 4,      ///< Surrogate model assisted algorithm.
+  ALGORITHM_CMAES = 5,          ///< CMA-ES algorithm.
+  ALGORITHM_SOBOL = 6,          ///< Scrambled Sobol sampling algorithm.
+  ALGORITHM_LATIN = 7           ///< Latin hypercube sampling algorithm.
 };
 
 /**
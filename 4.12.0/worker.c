@@ -0,0 +1,354 @@
+/*
+MPCOTool:
+The Multi-Purposes Calibration and Optimization Tool. A software to perform
+calibrations or optimizations of empirical parameters.
+
+AUTHORS: Javier Burguete and Borja Latorre.
+
+Copyright 2012-2023, AUTHORS.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice,
+        this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+        this list of conditions and the following disclaimer in the
+        documentation and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY AUTHORS ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+SHALL AUTHORS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGE.
+*/
+
+/**
+ * \file worker.c
+ * \brief Source file of a daemon calculating the simulations of a
+ *   coordinating mpcotool on other node.
+ *
+ * The syntax is:
+ * > $ ./mpcotool-worker [-s slots] host port simulator [evaluator]
+ *
+ * The daemon opens a TCP connection with the coordinating mpcotool for every
+ * slot of simulations (default is the number of cores), greeting with a line
+ * with the word "mpcotool-worker", the number of slots and the slot number.
+ * Then, on every connection, it receives the simulation requests of the
+ * persistent simulator server protocol, writes the rendered input files, runs
+ * the simulator and the evaluator in the working directory and replies with a
+ * line with the objective function value. If a request has no input files the
+ * variable values are written in a file, one per line, passed to the
+ * simulator as the only input file. The experimental data file names are
+ * relative to the working directory of the daemon and the file names of every
+ * slot contain the slot number and the process identifier, so several daemons
+ * can share a working directory.
+ * \authors Javier Burguete.
+ * \copyright Copyright 2012-2023, all rights reserved.
+ */
+#define _GNU_SOURCE
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+#include "tools.h"
+
+#define WORKER_LINE_LENGTH 4096 ///< Maximum length of the request lines.
+
+/**
+ * \struct Slot
+ * \brief Struct to define a slot of simulations.
+ */
+typedef struct
+{
+  FILE *request;                ///< Stream to receive the simulation requests.
+  FILE *reply;                  ///< Stream to send the objective values.
+  GThread *thread;              ///< Thread calculating the simulations.
+  unsigned int slot;            ///< Slot number.
+} Slot;
+
+static char *simulator;         ///< Simulator program.
+static char *evaluator;         ///< Evaluator program.
+
+/**
+ * Function to connect with the coordinating mpcotool.
+ *
+ * \return socket on success, -1 on error.
+ */
+static int
+worker_connect (const char *host,       ///< Host name of the coordinator.
+                const char *port)       ///< TCP port of the coordinator.
+{
+  struct addrinfo hints, *address, *a;
+  int fd = -1, yes = 1;
+  memset (&hints, 0, sizeof (hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo (host, port, &hints, &address))
+    return -1;
+  for (a = address; a; a = a->ai_next)
+    {
+      fd = socket (a->ai_family, a->ai_socktype, a->ai_protocol);
+      if (fd < 0)
+        continue;
+      if (!connect (fd, a->ai_addr, a->ai_addrlen))
+        break;
+      close (fd);
+      fd = -1;
+    }
+  freeaddrinfo (address);
+  if (fd >= 0)
+    setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof (int));
+  return fd;
+}
+
+/**
+ * Function to read a line of a request, removing the end of line.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+worker_line (FILE * request,    ///< Request stream.
+             char *line)        ///< Line of WORKER_LINE_LENGTH characters.
+{
+  if (!fgets (line, WORKER_LINE_LENGTH, request))
+    return 0;
+  line[strcspn (line, "\n")] = '\0';
+  return 1;
+}
+
+/**
+ * Function to copy a file of a request.
+ *
+ * \return 1 on success, 0 on error (a broken connection is detected reading
+ *   the next request).
+ */
+static int
+worker_copy (FILE * request,    ///< Request stream.
+             const char *name,  ///< File name.
+             size_t length)     ///< File length in bytes.
+{
+  char buffer[WORKER_LINE_LENGTH];
+  FILE *file;
+  size_t n;
+  int ok = 1;
+  file = g_fopen (name, "wb");
+  for (; length; length -= n)
+    {
+      n = fread (buffer, 1, MIN (length, WORKER_LINE_LENGTH), request);
+      if (!n)
+        {
+          ok = 0;
+          break;
+        }
+      if (file && fwrite (buffer, 1, n, file) != n)
+        ok = 0;
+    }
+  if (!file || fclose (file))
+    ok = 0;
+  return ok;
+}
+
+/**
+ * Function to read the objective function value, the first number of a file.
+ *
+ * \return 1 on success, 0 on error.
+ */
+static int
+worker_read (const char *name,  ///< File name.
+             double *e)         ///< Pointer to the objective function value.
+{
+  FILE *file;
+  int ok;
+  file = g_fopen (name, "r");
+  if (!file)
+    return 0;
+  ok = (fscanf (file, "%lf", e) == 1);
+  fclose (file);
+  return ok;
+}
+
+/**
+ * Function to receive a simulation request, to perform the simulation and to
+ *   calculate the objective function value.
+ *
+ * \return 1 on success, 0 on a broken connection.
+ */
+static int
+worker_simulate (Slot * slot)   ///< Slot struct.
+{
+  char line[WORKER_LINE_LENGTH], data[WORKER_LINE_LENGTH],
+    input[MAX_NINPUTS][32], output[32], result[32], *argv[MAX_NINPUTS + 3];
+  FILE *file = NULL;
+  double e;
+  unsigned int i, experiment, ninputs, nvariables;
+  int ok = 1;
+
+  // Reading the request header and the experimental data file name
+  if (!worker_line (slot->request, line)
+      || sscanf (line, "%u %u %u", &experiment, &ninputs, &nvariables) != 3
+      || ninputs > MAX_NINPUTS || !worker_line (slot->request, data))
+    return 0;
+
+  // Reading the variable values, saved as input file without input files
+  snprintf (input[0], 32, "input-0-%u-%d", slot->slot, (int) getpid ());
+  if (!ninputs)
+    file = g_fopen (input[0], "w");
+  for (i = 0; i < nvariables; ++i)
+    {
+      if (!worker_line (slot->request, line))
+        {
+          if (file)
+            fclose (file);
+          return 0;
+        }
+      if (file)
+        fprintf (file, "%s\n", line);
+    }
+  if (file && fclose (file))
+    ok = 0;
+
+  // Writing the input files
+  argv[0] = simulator;
+  for (i = 0; i < ninputs; ++i)
+    {
+      snprintf (input[i], 32, "input-%u-%u-%d", i, slot->slot,
+                (int) getpid ());
+      if (!worker_line (slot->request, line))
+        return 0;
+      if (!worker_copy (slot->request, input[i], strtoul (line, NULL, 10)))
+        ok = 0;
+      argv[i + 1] = input[i];
+    }
+  if (!ninputs)
+    argv[++i] = input[0];
+
+  // Performing the simulation
+  snprintf (output, 32, "output-%u-%d", slot->slot, (int) getpid ());
+  snprintf (result, 32, "result-%u-%d", slot->slot, (int) getpid ());
+  argv[i + 1] = output;
+  argv[i + 2] = NULL;
+  e = INFINITY;
+  if (!ok || tools_spawn (argv))
+    fprintf (stderr, "ERROR: simulation failed (%u-%u)\n", slot->slot,
+             experiment);
+
+  // Calculating the objective function value
+  else if (evaluator)
+    {
+      argv[0] = evaluator;
+      argv[1] = output;
+      argv[2] = data;
+      argv[3] = result;
+      argv[4] = NULL;
+      if (tools_spawn (argv) || !worker_read (result, &e))
+        {
+          fprintf (stderr, "ERROR: evaluation failed (%u-%u)\n", slot->slot,
+                   experiment);
+          e = INFINITY;
+        }
+    }
+  else if (!worker_read (output, &e))
+    {
+      fprintf (stderr, "ERROR: bad simulation output (%u-%u)\n", slot->slot,
+               experiment);
+      e = INFINITY;
+    }
+
+  // Removing files
+  for (i = 0; i < MAX (ninputs, 1u); ++i)
+    g_unlink (input[i]);
+  g_unlink (output);
+  g_unlink (result);
+
+  // Sending the objective function value
+  fprintf (slot->reply, "%.14le\n", e);
+  return !fflush (slot->reply);
+}
+
+/**
+ * Function to calculate the simulations of a slot until the coordinator
+ *   closes the connection.
+ *
+ * \return NULL.
+ */
+static gpointer
+worker_slot (Slot * slot)       ///< Slot struct.
+{
+  while (worker_simulate (slot));
+  return NULL;
+}
+
+/**
+ * Main function.
+ *
+ * \return 0 on success, >0 on error.
+ */
+int
+main (int argn,                 ///< Arguments number.
+      char **argc)              ///< Arguments pointer.
+{
+  Slot *slot;
+  unsigned int i, nslots;
+  int fd, arg = 1;
+
+  // Reading the arguments
+  nslots = g_get_num_processors ();
+  if (argn > 2 && !strcmp (argc[1], "-s"))
+    {
+      nslots = atoi (argc[2]);
+      arg = 3;
+    }
+  if (argn - arg < 3 || argn - arg > 4 || !nslots)
+    {
+      printf ("The syntax is:\n./mpcotool-worker [-s slots] host port "
+              "simulator [evaluator]\n");
+      return 1;
+    }
+  simulator = argc[arg + 2];
+  evaluator = (argn - arg == 4) ? argc[arg + 3] : NULL;
+
+  // Connecting the slots, the first greeting first
+  slot = (Slot *) g_malloc (nslots * sizeof (Slot));
+  for (i = 0; i < nslots; ++i)
+    {
+      fd = worker_connect (argc[arg], argc[arg + 1]);
+      if (fd < 0)
+        {
+          printf ("ERROR: unable to connect with %s:%s\n", argc[arg],
+                  argc[arg + 1]);
+          return 2;
+        }
+      slot[i].request = fdopen (fd, "rb");
+      slot[i].reply = fdopen (dup (fd), "wb");
+      slot[i].slot = i;
+      fprintf (slot[i].reply, "%s %u %u\n", WORKER_GREETING, nslots, i);
+      fflush (slot[i].reply);
+    }
+
+  // Calculating the simulations
+  for (i = 0; i < nslots; ++i)
+    slot[i].thread = g_thread_new (NULL, (GThreadFunc) worker_slot, slot + i);
+  for (i = 0; i < nslots; ++i)
+    {
+      g_thread_join (slot[i].thread);
+      fclose (slot[i].request);
+      fclose (slot[i].reply);
+    }
+  g_free (slot);
+  return 0;
+}
@@ -0,0 +1,17 @@
+#include <math.h>
+#include "../../4.12.0/plugin.h"
+
+static inline double
+Sphere (double x, double y)
+{
+  return x * x + y * y;
+}
+
+double
+mpcotool_variables (const double *variable,
+                    unsigned int nvariables __attribute__ ((unused)),
+                    unsigned int experiment __attribute__ ((unused)),
+                    const char *data __attribute__ ((unused)))
+{
+  return Sphere (variable[0] - M_PI_4, variable[1] - M_PI_4);
+}
@@ -0,0 +1,36 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+static inline double
+Sphere (double x, double y)
+{
+  return x * x + y * y;
+}
+
+int
+main ()
+{
+  char buffer[512];
+  double v[2];
+  unsigned long int length;
+  unsigned int experiment, ninputs, nvariables, i, j;
+  while (scanf ("%u%u%u%*c", &experiment, &ninputs, &nvariables) == 3)
+    {
+      if (nvariables != 2 || !fgets (buffer, 512, stdin))
+        return 1;
+      for (i = 0; i < nvariables; ++i)
+        if (scanf ("%lf%*c", v + i) != 1)
+          return 1;
+      for (i = 0; i < ninputs; ++i)
+        {
+          if (scanf ("%lu%*c", &length) != 1)
+            return 1;
+          for (j = 0; j < length; ++j)
+            getchar ();
+        }
+      printf ("%.14le\n", Sphere (v[0] - M_PI_4, v[1] - M_PI_4));
+      fflush (stdout);
+    }
+  return 0;
+}